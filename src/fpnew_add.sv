@@ -0,0 +1,568 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License. You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+//
+// SPDX-License-Identifier: SHL-0.51
+
+// Author: agent <agent@local>
+
+`include "common_cells/registers.svh"
+
+// Dual-path adder computing ADD (op[1] + op[2]) and SUB (op[1] - op[2]) without a multiplier. The
+// near path handles effective subtractions with exponents at most one apart, where massive
+// cancellation needs a full normalization but no alignment. The far path handles all other cases,
+// which need a full alignment but at most a one-bit normalization.
+module fpnew_add #(
+  parameter fpnew_pkg::fp_format_e   FpFormat    = fpnew_pkg::fp_format_e'(0),
+  parameter int unsigned             NumPipeRegs = 0,
+  parameter fpnew_pkg::pipe_config_t PipeConfig  = fpnew_pkg::BEFORE,
+  parameter type                     TagType     = logic,
+  parameter type                     AuxType     = logic,
+
+  localparam int unsigned WIDTH = fpnew_pkg::fp_width(FpFormat) // do not change
+) (
+  input logic                      clk_i,
+  input logic                      rst_ni,
+  // Input signals
+  input logic [2:0][WIDTH-1:0]     operands_i, // 3 operands, op[0] is unused
+  input logic [2:0]                is_boxed_i, // 3 operands
+  input fpnew_pkg::roundmode_e     rnd_mode_i,
+  input logic                      op_mod_i,
+  input TagType                    tag_i,
+  input AuxType                    aux_i,
+  // Input Handshake
+  input  logic                     in_valid_i,
+  output logic                     in_ready_o,
+  input  logic                     flush_i,
+  // Output signals
+  output logic [WIDTH-1:0]         result_o,
+  output fpnew_pkg::status_t       status_o,
+  output logic                     extension_bit_o,
+  output TagType                   tag_o,
+  output AuxType                   aux_o,
+  // Output handshake
+  output logic                     out_valid_o,
+  input  logic                     out_ready_i,
+  // Indication of valid data in flight
+  output logic                     busy_o
+);
+
+  // ----------
+  // Constants
+  // ----------
+  localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(FpFormat);
+  localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(FpFormat);
+  // Precision bits 'p' include the implicit bit
+  localparam int unsigned PRECISION_BITS = MAN_BITS + 1;
+  // The near path needs one guard bit, the far path guard, round and sticky bits
+  localparam int unsigned NEAR_WIDTH = PRECISION_BITS + 1;
+  localparam int unsigned FAR_WIDTH  = PRECISION_BITS + 3;
+  localparam int unsigned LZC_RESULT_WIDTH = $clog2(NEAR_WIDTH);
+  // Internal exponent holds the carry of the far path and the underflow of the near path
+  localparam int unsigned EXP_WIDTH = EXP_BITS + 2;
+  // Shift amount width: the far path alignment saturates at p+3 bits
+  localparam int unsigned SHIFT_AMOUNT_WIDTH = $clog2(FAR_WIDTH + 1);
+  // Pipelines
+  localparam NUM_INP_REGS = PipeConfig == fpnew_pkg::BEFORE
+                            ? NumPipeRegs
+                            : (PipeConfig == fpnew_pkg::DISTRIBUTED
+                               ? ((NumPipeRegs + 1) / 3) // Second to get distributed regs
+                               : 0); // no regs here otherwise
+  localparam NUM_MID_REGS = PipeConfig == fpnew_pkg::INSIDE
+                          ? NumPipeRegs
+                          : (PipeConfig == fpnew_pkg::DISTRIBUTED
+                             ? ((NumPipeRegs + 2) / 3) // First to get distributed regs
+                             : 0); // no regs here otherwise
+  localparam NUM_OUT_REGS = PipeConfig == fpnew_pkg::AFTER
+                            ? NumPipeRegs
+                            : (PipeConfig == fpnew_pkg::DISTRIBUTED
+                               ? (NumPipeRegs / 3) // Last to get distributed regs
+                               : 0); // no regs here otherwise
+
+  // ----------------
+  // Type definition
+  // ----------------
+  typedef struct packed {
+    logic                sign;
+    logic [EXP_BITS-1:0] exponent;
+    logic [MAN_BITS-1:0] mantissa;
+  } fp_t;
+
+  // ---------------
+  // Input pipeline
+  // ---------------
+  // Input pipeline signals, index i holds signal after i register stages
+  logic                  [0:NUM_INP_REGS][2:0][WIDTH-1:0] inp_pipe_operands_q;
+  logic                  [0:NUM_INP_REGS][2:0]            inp_pipe_is_boxed_q;
+  fpnew_pkg::roundmode_e [0:NUM_INP_REGS]                 inp_pipe_rnd_mode_q;
+  logic                  [0:NUM_INP_REGS]                 inp_pipe_op_mod_q;
+  TagType                [0:NUM_INP_REGS]                 inp_pipe_tag_q;
+  AuxType                [0:NUM_INP_REGS]                 inp_pipe_aux_q;
+  logic                  [0:NUM_INP_REGS]                 inp_pipe_valid_q;
+  // Ready signal is combinatorial for all stages
+  logic [0:NUM_INP_REGS] inp_pipe_ready;
+
+  // Input stage: First element of pipeline is taken from inputs
+  assign inp_pipe_operands_q[0] = operands_i;
+  assign inp_pipe_is_boxed_q[0] = is_boxed_i;
+  assign inp_pipe_rnd_mode_q[0] = rnd_mode_i;
+  assign inp_pipe_op_mod_q[0]   = op_mod_i;
+  assign inp_pipe_tag_q[0]      = tag_i;
+  assign inp_pipe_aux_q[0]      = aux_i;
+  assign inp_pipe_valid_q[0]    = in_valid_i;
+  // Input stage: Propagate pipeline ready signal to updtream circuitry
+  assign in_ready_o = inp_pipe_ready[0];
+  // Generate the register stages
+  for (genvar i = 0; i < NUM_INP_REGS; i++) begin : gen_input_pipeline
+    // Internal register enable for this stage
+    logic reg_ena;
+    // Determine the ready signal of the current stage - advance the pipeline:
+    // 1. if the next stage is ready for our data
+    // 2. if the next stage only holds a bubble (not valid) -> we can pop it
+    assign inp_pipe_ready[i] = inp_pipe_ready[i+1] | ~inp_pipe_valid_q[i+1];
+    // Valid: enabled by ready signal, synchronous clear with the flush signal
+    `FFLARNC(inp_pipe_valid_q[i+1], inp_pipe_valid_q[i], inp_pipe_ready[i], flush_i, 1'b0, clk_i, rst_ni)
+    // Enable register if pipleine ready and a valid data item is present
+    assign reg_ena = inp_pipe_ready[i] & inp_pipe_valid_q[i];
+    // Generate the pipeline registers within the stages, use enable-registers
+    `FFL(inp_pipe_operands_q[i+1], inp_pipe_operands_q[i], reg_ena, '0)
+    `FFL(inp_pipe_is_boxed_q[i+1], inp_pipe_is_boxed_q[i], reg_ena, '0)
+    `FFL(inp_pipe_rnd_mode_q[i+1], inp_pipe_rnd_mode_q[i], reg_ena, fpnew_pkg::RNE)
+    `FFL(inp_pipe_op_mod_q[i+1],   inp_pipe_op_mod_q[i],   reg_ena, '0)
+    `FFL(inp_pipe_tag_q[i+1],      inp_pipe_tag_q[i],      reg_ena, TagType'('0))
+    `FFL(inp_pipe_aux_q[i+1],      inp_pipe_aux_q[i],      reg_ena, AuxType'('0))
+  end
+
+  // -----------------
+  // Input processing
+  // -----------------
+  fpnew_pkg::fp_info_t [1:0] info_q;
+
+  // Classify input
+  fpnew_classifier #(
+    .FpFormat    ( FpFormat ),
+    .NumOperands ( 2        )
+    ) i_class_inputs (
+    .operands_i ( inp_pipe_operands_q[NUM_INP_REGS][2:1] ),
+    .is_boxed_i ( inp_pipe_is_boxed_q[NUM_INP_REGS][2:1] ),
+    .info_o     ( info_q                                 )
+  );
+
+  fp_t                 operand_a, operand_b;
+  fpnew_pkg::fp_info_t info_a,    info_b;
+
+  // Operands are taken from the FMA addend positions, op_mod_q inverts the sign of operand B
+  assign operand_a = inp_pipe_operands_q[NUM_INP_REGS][1];
+  assign operand_b = {inp_pipe_operands_q[NUM_INP_REGS][2][WIDTH-1] ^ inp_pipe_op_mod_q[NUM_INP_REGS],
+                      inp_pipe_operands_q[NUM_INP_REGS][2][WIDTH-2:0]};
+  assign info_a    = info_q[0];
+  assign info_b    = info_q[1];
+
+  // ---------------------
+  // Input classification
+  // ---------------------
+  logic any_operand_inf;
+  logic any_operand_nan;
+  logic signalling_nan;
+  logic effective_subtraction;
+
+  // Reduction for special case handling
+  assign any_operand_inf = (| {info_a.is_inf,        info_b.is_inf});
+  assign any_operand_nan = (| {info_a.is_nan,        info_b.is_nan});
+  assign signalling_nan  = (| {info_a.is_signalling, info_b.is_signalling});
+  // Effective subtraction occurs when the operand signs differ
+  assign effective_subtraction = operand_a.sign ^ operand_b.sign;
+
+  // ----------------------
+  // Special case handling
+  // ----------------------
+  fp_t                special_result;
+  fpnew_pkg::status_t special_status;
+  logic               result_is_special;
+
+  always_comb begin : special_cases
+    // Default assignments
+    special_result    = '{sign: 1'b0, exponent: '1, mantissa: 2**(MAN_BITS-1)}; // canonical qNaN
+    special_status    = '0;
+    result_is_special = 1'b0;
+
+    // NaN Inputs cause canonical quiet NaN at the output and maybe invalid OP
+    if (any_operand_nan) begin
+      result_is_special = 1'b1;           // bypass adder, output is the canonical qNaN
+      special_status.NV = signalling_nan; // raise the invalid operation flag if signalling
+    // Special cases involving infinity
+    end else if (any_operand_inf) begin
+      result_is_special = 1'b1; // bypass adder
+      // Effective addition of opposite infinities (±inf - ±inf) is invalid!
+      if (info_a.is_inf && info_b.is_inf && effective_subtraction)
+        special_status.NV = 1'b1; // invalid operation
+      // Result is infinity with the sign of the infinite operand
+      else
+        special_result = '{sign: info_a.is_inf ? operand_a.sign : operand_b.sign,
+                           exponent: '1, mantissa: '0};
+    end
+  end
+
+  // ------------------
+  // Operand swapping
+  // ------------------
+  fp_t                       operand_big, operand_small;
+  fpnew_pkg::fp_info_t       info_big,    info_small;
+  logic signed [EXP_WIDTH-1:0] exponent_big, exponent_small, exponent_difference;
+  logic [PRECISION_BITS-1:0] mantissa_big, mantissa_small;
+  logic                      near_path;
+
+  // The larger magnitude is found by comparing the encodings, ties keep operand A
+  always_comb begin : swap_operands
+    if ({operand_b.exponent, operand_b.mantissa} > {operand_a.exponent, operand_a.mantissa}) begin
+      operand_big   = operand_b;
+      operand_small = operand_a;
+      info_big      = info_b;
+      info_small    = info_a;
+    end else begin
+      operand_big   = operand_a;
+      operand_small = operand_b;
+      info_big      = info_a;
+      info_small    = info_b;
+    end
+  end
+
+  // Real exponents are (ex = Ex - bias + 1 - nx), internal exponents stay biased
+  assign exponent_big   = signed'({1'b0, operand_big.exponent}) + signed'({1'b0, ~info_big.is_normal});
+  assign exponent_small = signed'({1'b0, operand_small.exponent})
+                          + signed'({1'b0, ~info_small.is_normal});
+  // Non-negative as the larger magnitude has the larger exponent
+  assign exponent_difference = exponent_big - exponent_small;
+
+  // Add implicit bits to mantissae
+  assign mantissa_big   = {info_big.is_normal,   operand_big.mantissa};
+  assign mantissa_small = {info_small.is_normal, operand_small.mantissa};
+
+  // Cancellations of more than one bit only occur in effective subtractions of close exponents
+  assign near_path = effective_subtraction && (exponent_difference <= 1);
+
+  // ----------
+  // Near path
+  // ----------
+  logic [NEAR_WIDTH-1:0]       near_small;      // aligned by at most one bit
+  logic [NEAR_WIDTH-1:0]       near_difference; // exact, never negative
+  logic [LZC_RESULT_WIDTH-1:0] near_lzc;
+  logic                        near_zero;       // exact cancellation
+  logic [LZC_RESULT_WIDTH-1:0] near_shamt;
+  logic [NEAR_WIDTH-1:0]       near_shifted;
+  logic signed [EXP_WIDTH-1:0] near_exponent;
+
+  // The difference is placed into a p+1 bit wide vector, with a guard bit for the aligned operand:
+  // | mantissa | G |
+  //  <-  p   -> <1>
+  assign near_small      = exponent_difference[0] ? {1'b0, mantissa_small}
+                                                  : {mantissa_small, 1'b0};
+  assign near_difference = {mantissa_big, 1'b0} - near_small;
+
+  // Leading zero counter for cancellations
+  lzc #(
+    .WIDTH ( NEAR_WIDTH ),
+    .MODE  ( 1          ) // MODE = 1 counts leading zeroes
+  ) i_near_lzc (
+    .in_i    ( near_difference ),
+    .cnt_o   ( near_lzc        ),
+    .empty_o ( near_zero       )
+  );
+
+  // Normalization shift amount based on exponent and LZC
+  always_comb begin : near_shift_amount
+    // Exact zero result
+    if (near_zero) begin
+      near_shamt    = '0;
+      near_exponent = '0;
+    // Normal result (biased exponent > 0), remove the counted zeroes
+    end else if (exponent_big > signed'({1'b0, near_lzc})) begin
+      near_shamt    = near_lzc;
+      near_exponent = exponent_big - signed'({1'b0, near_lzc});
+    // Subnormal result, cap the shift distance to align mantissa with minimum exponent
+    end else begin
+      near_shamt    = LZC_RESULT_WIDTH'(unsigned'(exponent_big - 1));
+      near_exponent = '0; // subnormals encoded as 0
+    end
+  end
+
+  assign near_shifted = near_difference << near_shamt;
+
+  // ---------
+  // Far path
+  // ---------
+  logic [SHIFT_AMOUNT_WIDTH-1:0] far_shamt;
+  logic [FAR_WIDTH-1:0]          far_small_shifted;   // aligned with guard and round bits
+  logic [FAR_WIDTH-1:0]          far_sticky_bits;     // bits shifted out are sticky
+  logic [FAR_WIDTH:0]            far_big, far_small;  // added one bit for the carry
+  logic [FAR_WIDTH:0]            far_sum;
+  logic [PRECISION_BITS:0]       far_mantissa;        // mantissa with round bit
+  logic                          far_sticky;
+  logic signed [EXP_WIDTH-1:0]   far_exponent;
+
+  // Alignment shift, saturated such that the smaller mantissa only affects the sticky bit
+  assign far_shamt = (exponent_difference >= signed'(FAR_WIDTH))
+                     ? FAR_WIDTH
+                     : SHIFT_AMOUNT_WIDTH'(unsigned'(exponent_difference));
+
+  // BEFORE THE SHIFT:
+  // | mantissa | GRS | 000...000 |
+  //  <-  p   -> < 3> <-  p+3  ->
+  assign {far_small_shifted, far_sticky_bits} =
+      {mantissa_small, 3'b000, {FAR_WIDTH{1'b0}}} >> far_shamt;
+
+  // The sticky bit is kept in the LSB, enough for the one-bit normalization of the far path
+  assign far_big   = {1'b0, mantissa_big, 3'b000};
+  assign far_small = {1'b0, far_small_shifted[FAR_WIDTH-1:1],
+                      far_small_shifted[0] | (| far_sticky_bits)};
+
+  // Effective subtractions of exponents at least two apart lose at most one bit
+  assign far_sum = effective_subtraction ? far_big - far_small : far_big + far_small;
+
+  // One-bit normalization of the far path
+  always_comb begin : far_normalization
+    // The sum has overflown, align right and fix exponent
+    if (far_sum[FAR_WIDTH]) begin
+      far_mantissa = far_sum[FAR_WIDTH:3];
+      far_sticky   = (| far_sum[2:0]);
+      far_exponent = exponent_big + 1;
+    // The sum is normal, nothing to do
+    end else if (far_sum[FAR_WIDTH-1]) begin
+      far_mantissa = far_sum[FAR_WIDTH-1:2];
+      far_sticky   = (| far_sum[1:0]);
+      far_exponent = exponent_big;
+    // The difference lost a bit, align left - unless the result is already subnormal
+    end else if (exponent_big > 1) begin
+      far_mantissa = far_sum[FAR_WIDTH-2:1];
+      far_sticky   = far_sum[0];
+      far_exponent = exponent_big - 1;
+    // Otherwise we're denormal
+    end else begin
+      far_mantissa = far_sum[FAR_WIDTH-1:2];
+      far_sticky   = (| far_sum[1:0]);
+      far_exponent = '0;
+    end
+  end
+
+  // -------------
+  // Path selection
+  // -------------
+  logic signed [EXP_WIDTH-1:0] final_exponent;
+  logic [PRECISION_BITS:0]     final_mantissa; // final mantissa before rounding with round bit
+  logic                        final_sticky;
+  logic                        final_sign;
+
+  // The near path is exact, its guard bit is the round bit
+  assign final_exponent = near_path ? near_exponent : far_exponent;
+  assign final_mantissa = near_path ? near_shifted  : far_mantissa;
+  assign final_sticky   = near_path ? 1'b0          : far_sticky;
+  // The result takes the sign of the larger operand
+  assign final_sign     = operand_big.sign;
+
+  // ---------------
+  // Internal pipeline
+  // ---------------
+  // Pipeline output signals as non-arrays
+  logic                        effective_subtraction_q;
+  logic signed [EXP_WIDTH-1:0] final_exponent_q;
+  logic [PRECISION_BITS:0]     final_mantissa_q;
+  logic                        final_sticky_q;
+  logic                        final_sign_q;
+  fpnew_pkg::roundmode_e       rnd_mode_q;
+  logic                        result_is_special_q;
+  fp_t                         special_result_q;
+  fpnew_pkg::status_t          special_status_q;
+  // Internal pipeline signals, index i holds signal after i register stages
+  logic                  [0:NUM_MID_REGS]                     mid_pipe_eff_sub_q;
+  logic signed           [0:NUM_MID_REGS][EXP_WIDTH-1:0]      mid_pipe_exp_q;
+  logic                  [0:NUM_MID_REGS][PRECISION_BITS:0]   mid_pipe_man_q;
+  logic                  [0:NUM_MID_REGS]                     mid_pipe_sticky_q;
+  logic                  [0:NUM_MID_REGS]                     mid_pipe_final_sign_q;
+  fpnew_pkg::roundmode_e [0:NUM_MID_REGS]                     mid_pipe_rnd_mode_q;
+  logic                  [0:NUM_MID_REGS]                     mid_pipe_res_is_spec_q;
+  fp_t                   [0:NUM_MID_REGS]                     mid_pipe_spec_res_q;
+  fpnew_pkg::status_t    [0:NUM_MID_REGS]                     mid_pipe_spec_stat_q;
+  TagType                [0:NUM_MID_REGS]                     mid_pipe_tag_q;
+  AuxType                [0:NUM_MID_REGS]                     mid_pipe_aux_q;
+  logic                  [0:NUM_MID_REGS]                     mid_pipe_valid_q;
+  // Ready signal is combinatorial for all stages
+  logic [0:NUM_MID_REGS] mid_pipe_ready;
+
+  // Input stage: First element of pipeline is taken from upstream logic
+  assign mid_pipe_eff_sub_q[0]     = effective_subtraction;
+  assign mid_pipe_exp_q[0]         = final_exponent;
+  assign mid_pipe_man_q[0]         = final_mantissa;
+  assign mid_pipe_sticky_q[0]      = final_sticky;
+  assign mid_pipe_final_sign_q[0]  = final_sign;
+  assign mid_pipe_rnd_mode_q[0]    = inp_pipe_rnd_mode_q[NUM_INP_REGS];
+  assign mid_pipe_res_is_spec_q[0] = result_is_special;
+  assign mid_pipe_spec_res_q[0]    = special_result;
+  assign mid_pipe_spec_stat_q[0]   = special_status;
+  assign mid_pipe_tag_q[0]         = inp_pipe_tag_q[NUM_INP_REGS];
+  assign mid_pipe_aux_q[0]         = inp_pipe_aux_q[NUM_INP_REGS];
+  assign mid_pipe_valid_q[0]       = inp_pipe_valid_q[NUM_INP_REGS];
+  // Input stage: Propagate pipeline ready signal to input pipe
+  assign inp_pipe_ready[NUM_INP_REGS] = mid_pipe_ready[0];
+
+  // Generate the register stages
+  for (genvar i = 0; i < NUM_MID_REGS; i++) begin : gen_inside_pipeline
+    // Internal register enable for this stage
+    logic reg_ena;
+    // Determine the ready signal of the current stage - advance the pipeline:
+    // 1. if the next stage is ready for our data
+    // 2. if the next stage only holds a bubble (not valid) -> we can pop it
+    assign mid_pipe_ready[i] = mid_pipe_ready[i+1] | ~mid_pipe_valid_q[i+1];
+    // Valid: enabled by ready signal, synchronous clear with the flush signal
+    `FFLARNC(mid_pipe_valid_q[i+1], mid_pipe_valid_q[i], mid_pipe_ready[i], flush_i, 1'b0, clk_i, rst_ni)
+    // Enable register if pipleine ready and a valid data item is present
+    assign reg_ena = mid_pipe_ready[i] & mid_pipe_valid_q[i];
+    // Generate the pipeline registers within the stages, use enable-registers
+    `FFL(mid_pipe_eff_sub_q[i+1],     mid_pipe_eff_sub_q[i],     reg_ena, '0)
+    `FFL(mid_pipe_exp_q[i+1],         mid_pipe_exp_q[i],         reg_ena, '0)
+    `FFL(mid_pipe_man_q[i+1],         mid_pipe_man_q[i],         reg_ena, '0)
+    `FFL(mid_pipe_sticky_q[i+1],      mid_pipe_sticky_q[i],      reg_ena, '0)
+    `FFL(mid_pipe_final_sign_q[i+1],  mid_pipe_final_sign_q[i],  reg_ena, '0)
+    `FFL(mid_pipe_rnd_mode_q[i+1],    mid_pipe_rnd_mode_q[i],    reg_ena, fpnew_pkg::RNE)
+    `FFL(mid_pipe_res_is_spec_q[i+1], mid_pipe_res_is_spec_q[i], reg_ena, '0)
+    `FFL(mid_pipe_spec_res_q[i+1],    mid_pipe_spec_res_q[i],    reg_ena, '0)
+    `FFL(mid_pipe_spec_stat_q[i+1],   mid_pipe_spec_stat_q[i],   reg_ena, '0)
+    `FFL(mid_pipe_tag_q[i+1],         mid_pipe_tag_q[i],         reg_ena, TagType'('0))
+    `FFL(mid_pipe_aux_q[i+1],         mid_pipe_aux_q[i],         reg_ena, AuxType'('0))
+  end
+  // Output stage: assign selected pipe outputs to signals for later use
+  assign effective_subtraction_q = mid_pipe_eff_sub_q[NUM_MID_REGS];
+  assign final_exponent_q        = mid_pipe_exp_q[NUM_MID_REGS];
+  assign final_mantissa_q        = mid_pipe_man_q[NUM_MID_REGS];
+  assign final_sticky_q          = mid_pipe_sticky_q[NUM_MID_REGS];
+  assign final_sign_q            = mid_pipe_final_sign_q[NUM_MID_REGS];
+  assign rnd_mode_q              = mid_pipe_rnd_mode_q[NUM_MID_REGS];
+  assign result_is_special_q     = mid_pipe_res_is_spec_q[NUM_MID_REGS];
+  assign special_result_q        = mid_pipe_spec_res_q[NUM_MID_REGS];
+  assign special_status_q        = mid_pipe_spec_stat_q[NUM_MID_REGS];
+
+  // ----------------------------
+  // Rounding and classification
+  // ----------------------------
+  logic                         pre_round_sign;
+  logic [EXP_BITS-1:0]          pre_round_exponent;
+  logic [MAN_BITS-1:0]          pre_round_mantissa;
+  logic [EXP_BITS+MAN_BITS-1:0] pre_round_abs; // absolute value of result before rounding
+  logic [1:0]                   round_sticky_bits;
+
+  logic of_before_round, of_after_round; // overflow
+  logic uf_after_round;                  // underflow
+  logic result_zero;
+
+  logic                         rounded_sign;
+  logic [EXP_BITS+MAN_BITS-1:0] rounded_abs; // absolute value of result after rounding
+
+  // Classification before round. RISC-V mandates checking underflow AFTER rounding!
+  assign of_before_round = final_exponent_q >= 2**(EXP_BITS)-1; // infinity exponent is all ones
+
+  // Assemble result before rounding. In case of overflow, the largest normal value is set.
+  assign pre_round_sign     = final_sign_q;
+  assign pre_round_exponent = (of_before_round) ? 2**EXP_BITS-2 : unsigned'(final_exponent_q[EXP_BITS-1:0]);
+  assign pre_round_mantissa = (of_before_round) ? '1 : final_mantissa_q[MAN_BITS:1]; // bit 0 is R bit
+  assign pre_round_abs      = {pre_round_exponent, pre_round_mantissa};
+
+  // In case of overflow, the round and sticky bits are set for proper rounding
+  assign round_sticky_bits  = (of_before_round) ? 2'b11 : {final_mantissa_q[0], final_sticky_q};
+
+  // Perform the rounding
+  fpnew_rounding #(
+    .AbsWidth ( EXP_BITS + MAN_BITS )
+  ) i_fpnew_rounding (
+    .abs_value_i             ( pre_round_abs           ),
+    .sign_i                  ( pre_round_sign          ),
+    .round_sticky_bits_i     ( round_sticky_bits       ),
+    .rnd_mode_i              ( rnd_mode_q              ),
+    .effective_subtraction_i ( effective_subtraction_q ),
+    .fraction_i              ( '0                      ), // no stochastic rounding
+    .random_i                ( '0                      ), // no stochastic rounding
+    .abs_rounded_o           ( rounded_abs             ),
+    .sign_o                  ( rounded_sign            ),
+    .exact_zero_o            ( result_zero             )
+  );
+
+  // Classification after rounding
+  assign uf_after_round = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '0; // exponent = 0
+  assign of_after_round = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '1; // exponent all ones
+
+  // -----------------
+  // Result selection
+  // -----------------
+  logic [WIDTH-1:0]     regular_result;
+  fpnew_pkg::status_t   regular_status;
+
+  // Assemble regular result
+  assign regular_result    = {rounded_sign, rounded_abs};
+  assign regular_status.NV = 1'b0; // only valid cases are handled in regular path
+  assign regular_status.DZ = 1'b0; // no divisions
+  assign regular_status.OF = of_before_round | of_after_round;   // rounding can introduce overflow
+  assign regular_status.UF = uf_after_round & regular_status.NX; // only inexact results raise UF
+  assign regular_status.NX = (| round_sticky_bits) | of_before_round | of_after_round;
+
+  // Final results for output pipeline
+  fp_t                result_d;
+  fpnew_pkg::status_t status_d;
+
+  // Select output depending on special case detection
+  assign result_d = result_is_special_q ? special_result_q : regular_result;
+  assign status_d = result_is_special_q ? special_status_q : regular_status;
+
+  // ----------------
+  // Output Pipeline
+  // ----------------
+  // Output pipeline signals, index i holds signal after i register stages
+  fp_t                [0:NUM_OUT_REGS] out_pipe_result_q;
+  fpnew_pkg::status_t [0:NUM_OUT_REGS] out_pipe_status_q;
+  TagType             [0:NUM_OUT_REGS] out_pipe_tag_q;
+  AuxType             [0:NUM_OUT_REGS] out_pipe_aux_q;
+  logic               [0:NUM_OUT_REGS] out_pipe_valid_q;
+  // Ready signal is combinatorial for all stages
+  logic [0:NUM_OUT_REGS] out_pipe_ready;
+
+  // Input stage: First element of pipeline is taken from inputs
+  assign out_pipe_result_q[0] = result_d;
+  assign out_pipe_status_q[0] = status_d;
+  assign out_pipe_tag_q[0]    = mid_pipe_tag_q[NUM_MID_REGS];
+  assign out_pipe_aux_q[0]    = mid_pipe_aux_q[NUM_MID_REGS];
+  assign out_pipe_valid_q[0]  = mid_pipe_valid_q[NUM_MID_REGS];
+  // Input stage: Propagate pipeline ready signal to inside pipe
+  assign mid_pipe_ready[NUM_MID_REGS] = out_pipe_ready[0];
+  // Generate the register stages
+  for (genvar i = 0; i < NUM_OUT_REGS; i++) begin : gen_output_pipeline
+    // Internal register enable for this stage
+    logic reg_ena;
+    // Determine the ready signal of the current stage - advance the pipeline:
+    // 1. if the next stage is ready for our data
+    // 2. if the next stage only holds a bubble (not valid) -> we can pop it
+    assign out_pipe_ready[i] = out_pipe_ready[i+1] | ~out_pipe_valid_q[i+1];
+    // Valid: enabled by ready signal, synchronous clear with the flush signal
+    `FFLARNC(out_pipe_valid_q[i+1], out_pipe_valid_q[i], out_pipe_ready[i], flush_i, 1'b0, clk_i, rst_ni)
+    // Enable register if pipleine ready and a valid data item is present
+    assign reg_ena = out_pipe_ready[i] & out_pipe_valid_q[i];
+    // Generate the pipeline registers within the stages, use enable-registers
+    `FFL(out_pipe_result_q[i+1], out_pipe_result_q[i], reg_ena, '0)
+    `FFL(out_pipe_status_q[i+1], out_pipe_status_q[i], reg_ena, '0)
+    `FFL(out_pipe_tag_q[i+1],    out_pipe_tag_q[i],    reg_ena, TagType'('0))
+    `FFL(out_pipe_aux_q[i+1],    out_pipe_aux_q[i],    reg_ena, AuxType'('0))
+  end
+  // Output stage: Ready travels backwards from output side, driven by downstream circuitry
+  assign out_pipe_ready[NUM_OUT_REGS] = out_ready_i;
+  // Output stage: assign module outputs
+  assign result_o        = out_pipe_result_q[NUM_OUT_REGS];
+  assign status_o        = out_pipe_status_q[NUM_OUT_REGS];
+  assign extension_bit_o = 1'b1; // always NaN-Box result
+  assign tag_o           = out_pipe_tag_q[NUM_OUT_REGS];
+  assign aux_o           = out_pipe_aux_q[NUM_OUT_REGS];
+  assign out_valid_o     = out_pipe_valid_q[NUM_OUT_REGS];
+  assign busy_o          = (| {inp_pipe_valid_q, mid_pipe_valid_q, out_pipe_valid_q});
+endmodule
@@ -0,0 +1,99 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License. You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+//
+// SPDX-License-Identifier: SHL-0.51
+
+// Author: agent <agent@local>
+
+module fpnew_arbiter #(
+  parameter int unsigned            NumIn      = 4,
+  parameter type                    DataType   = logic,
+  parameter fpnew_pkg::arb_config_t ArbConfig  = fpnew_pkg::ROUND_ROBIN,
+  parameter int unsigned            StampWidth = 1, // Width of the issue stamps used for ageing
+  // Do not change
+  localparam int unsigned IDX_WIDTH = (NumIn > 1) ? $clog2(NumIn) : 1
+) (
+  input  logic                             clk_i,
+  input  logic                             rst_ni,
+  input  logic                             flush_i,
+  // Input side
+  input  logic [NumIn-1:0]                 req_i,
+  output logic [NumIn-1:0]                 gnt_o,
+  input  DataType [NumIn-1:0]              data_i,
+  input  logic [NumIn-1:0][StampWidth-1:0] stamp_i, // issue stamps, only used for OLDEST_FIRST
+  // Output side
+  input  logic                             gnt_i,
+  output logic                             req_o,
+  output DataType                          data_o,
+  output logic [IDX_WIDTH-1:0]             idx_o
+);
+
+  // ---------------------
+  // Oldest-First Arbiter
+  // ---------------------
+  if (ArbConfig == fpnew_pkg::OLDEST_FIRST) begin : gen_oldest_first
+
+    logic [StampWidth-1:0] oldest_stamp;
+
+    // Stamps are handed out in ascending order and wrap around, compare them modulo 2^StampWidth.
+    // A wrong decision due to more in-flight operations than stamps only affects priority.
+    function automatic logic is_older(logic [StampWidth-1:0] a, logic [StampWidth-1:0] b);
+      automatic logic [StampWidth-1:0] difference = a - b;
+      return difference[StampWidth-1]; // a is older if a - b is negative
+    endfunction
+
+    // Find the oldest request, lower indices win on equal stamps
+    always_comb begin : find_oldest
+      req_o        = 1'b0;
+      idx_o        = '0;
+      oldest_stamp = '0;
+      for (int unsigned i = 0; i < NumIn; i++) begin
+        if (req_i[i] && (!req_o || is_older(stamp_i[i], oldest_stamp))) begin
+          req_o        = 1'b1;
+          idx_o        = IDX_WIDTH'(i);
+          oldest_stamp = stamp_i[i];
+        end
+      end
+    end
+
+    assign data_o = data_i[idx_o];
+
+    // Grant goes to the selected input only
+    always_comb begin : assign_grant
+      gnt_o        = '0;
+      gnt_o[idx_o] = req_o & gnt_i;
+    end
+
+  // --------------------
+  // Round-Robin Arbiter
+  // --------------------
+  end else begin : gen_round_robin
+
+    rr_arb_tree #(
+      .NumIn     ( NumIn    ),
+      .DataType  ( DataType ),
+      .AxiVldRdy ( 1'b1     )
+    ) i_arbiter (
+      .clk_i,
+      .rst_ni,
+      .flush_i,
+      .rr_i   ( '0     ),
+      .req_i,
+      .gnt_o,
+      .data_i,
+      .gnt_i,
+      .req_o,
+      .data_o,
+      .idx_o
+    );
+  end
+
+endmodule
@@ -0,0 +1,112 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License. You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+//
+// SPDX-License-Identifier: SHL-0.51
+
+// Author: agent <agent@local>
+
+// Unsigned radix-4 Booth multiplier with a 3:2 compressor tree. The product is returned in
+// carry-save form (sum_o + carry_o), exact modulo 2**ResultWidth, such that it can be merged into a
+// following addition without a carry-propagate adder of its own. Pipeline registers are spread
+// evenly over the Booth recoding and the compressor levels by the compressor tree.
+module fpnew_booth_multiplier #(
+  parameter int unsigned Width       = 24,        // width of the unsigned operands
+  parameter int unsigned ResultWidth = 2 * Width, // at least 2 * Width
+  parameter int unsigned NumPipeRegs = 0,
+
+  localparam int unsigned NUM_ENA = fpnew_pkg::maximum(NumPipeRegs, 1) // do not change
+) (
+  input  logic                   clk_i,
+  input  logic                   rst_ni,
+  // Operands
+  input  logic [Width-1:0]       a_i,
+  input  logic [Width-1:0]       b_i,
+  // Register enables, one per pipeline stage in order
+  input  logic [NUM_ENA-1:0]     reg_ena_i,
+  // Product in carry-save form
+  output logic [ResultWidth-1:0] sum_o,
+  output logic [ResultWidth-1:0] carry_o
+);
+
+  // ----------
+  // Constants
+  // ----------
+  // One partial product per radix-4 digit of the zero-extended multiplier
+  localparam int unsigned NUM_PP = Width / 2 + 1;
+  // The negation bits and the sign-extension constant are added as two more rows
+  localparam int unsigned NUM_ROWS = NUM_PP + 2;
+
+  // The sign extension of all partial products, as a constant to be added
+  function automatic logic [ResultWidth-1:0] sign_constant();
+    automatic logic [ResultWidth-1:0] res = '0;
+    for (int unsigned i = 0; i < NUM_PP; i++)
+      if (Width + 1 + 2 * i < ResultWidth) res[Width + 1 + 2 * i] = 1'b1;
+    return -res;
+  endfunction
+
+  // Rows to be added
+  logic [NUM_ROWS-1:0][ResultWidth-1:0] rows;
+
+  // -----------------
+  // Partial products
+  // -----------------
+  logic [Width+2:0]        multiplier;  // zero-extended, with the implicit zero bit below
+  logic [NUM_PP-1:0]       pp_negative; // negated partial products
+  logic [ResultWidth-1:0]  negation_row;
+
+  assign multiplier = {2'b0, b_i, 1'b0};
+
+  // Each overlapping triplet of multiplier bits selects one of 0, +-a and +-2a
+  for (genvar i = 0; i < int'(NUM_PP); i++) begin : gen_partial_products
+    logic             pp_one, pp_two;
+    logic [Width:0]   magnitude;
+    logic [Width+1:0] partial_product;
+
+    assign pp_one = multiplier[2*i+1] ^ multiplier[2*i];
+    assign pp_two = (multiplier[2*i+2] & ~multiplier[2*i+1] & ~multiplier[2*i])
+                    | (~multiplier[2*i+2] & multiplier[2*i+1] & multiplier[2*i]);
+    assign pp_negative[i] = multiplier[2*i+2] & ~(multiplier[2*i+1] & multiplier[2*i]);
+
+    assign magnitude = pp_one ? {1'b0, a_i} : (pp_two ? {a_i, 1'b0} : '0);
+    // Negative partial products are inverted here, the missing +1 is in the negation row
+    assign partial_product = {1'b0, magnitude} ^ {(Width+2){pp_negative[i]}};
+
+    // The sign extension is replaced by the inverted sign bit and the constant row
+    assign rows[i] = ResultWidth'({~partial_product[Width+1], partial_product[Width:0]})
+                     << (2 * i);
+  end
+
+  // The +1 completing the negated partial products, one bit per partial product
+  always_comb begin : negation_bits
+    negation_row = '0;
+    for (int unsigned i = 0; i < NUM_PP; i++) negation_row[2*i] = pp_negative[i];
+  end
+
+  assign rows[NUM_PP]   = negation_row;
+  assign rows[NUM_PP+1] = sign_constant();
+
+  // ----------------
+  // Compressor tree
+  // ----------------
+  fpnew_compressor_tree #(
+    .Width       ( ResultWidth ),
+    .NumRows     ( NUM_ROWS    ),
+    .NumPipeRegs ( NumPipeRegs )
+  ) i_compressor_tree (
+    .clk_i,
+    .rst_ni,
+    .rows_i    ( rows      ),
+    .reg_ena_i,
+    .sum_o,
+    .carry_o
+  );
+
+endmodule
@@ -18,44 +18,50 @@
 module fpnew_cast_multi #(
   parameter fpnew_pkg::fmt_logic_t   FpFmtConfig  = '1,
   parameter fpnew_pkg::ifmt_logic_t  IntFmtConfig = '1,
+  parameter fpnew_pkg::fmt_logic_t   FtzFmtConfig = '0, // formats flushing subnormals to zero
   // FPU configuration
-  parameter int unsigned             NumPipeRegs = 0,
-  parameter fpnew_pkg::pipe_config_t PipeConfig  = fpnew_pkg::BEFORE,
-  parameter type                     TagType     = logic,
-  parameter type                     AuxType     = logic,
+  parameter int unsigned             NumPipeRegs  = 0,
+  parameter fpnew_pkg::pipe_config_t PipeConfig   = fpnew_pkg::BEFORE,
+  parameter type                     TagType      = logic,
+  parameter type                     AuxType      = logic,
+  parameter logic [31:0]             SrResetState = fpnew_pkg::SR_RESET_SEED, // LFSR reset
   // Do not change
   localparam int unsigned WIDTH = fpnew_pkg::maximum(fpnew_pkg::max_fp_width(FpFmtConfig),
                                                      fpnew_pkg::max_int_width(IntFmtConfig)),
-  localparam int unsigned NUM_FORMATS = fpnew_pkg::NUM_FP_FORMATS
+  localparam int unsigned NUM_FORMATS  = fpnew_pkg::NUM_FP_FORMATS,
+  localparam int unsigned SR_SEED_BITS = fpnew_pkg::SR_SEED_BITS
 ) (
-  input  logic                   clk_i,
-  input  logic                   rst_ni,
+  input  logic                    clk_i,
+  input  logic                    rst_ni,
   // Input signals
-  input  logic [WIDTH-1:0]       operands_i, // 1 operand
-  input  logic [NUM_FORMATS-1:0] is_boxed_i, // 1 operand
-  input  fpnew_pkg::roundmode_e  rnd_mode_i,
-  input  fpnew_pkg::operation_e  op_i,
-  input  logic                   op_mod_i,
-  input  fpnew_pkg::fp_format_e  src_fmt_i,
-  input  fpnew_pkg::fp_format_e  dst_fmt_i,
-  input  fpnew_pkg::int_format_e int_fmt_i,
-  input  TagType                 tag_i,
-  input  AuxType                 aux_i,
+  input  logic [WIDTH-1:0]        operands_i, // 1 operand
+  input  logic [NUM_FORMATS-1:0]  is_boxed_i, // 1 operand
+  input  fpnew_pkg::roundmode_e   rnd_mode_i,
+  input  fpnew_pkg::operation_e   op_i,
+  input  logic                    op_mod_i,
+  input  fpnew_pkg::fp_format_e   src_fmt_i,
+  input  fpnew_pkg::fp_format_e   dst_fmt_i,
+  input  fpnew_pkg::int_format_e  int_fmt_i,
+  input  TagType                  tag_i,
+  input  AuxType                  aux_i,
+  input  fpnew_pkg::mx_scales_t   mx_scales_i,    // MX block scale of the operand in element 0
+  input  logic [SR_SEED_BITS-1:0] sr_seed_i,      // seed for stochastic rounding
+  input  logic                    sr_seed_load_i, // load the seed
   // Input Handshake
-  input  logic                   in_valid_i,
-  output logic                   in_ready_o,
-  input  logic                   flush_i,
+  input  logic                    in_valid_i,
+  output logic                    in_ready_o,
+  input  logic                    flush_i,
   // Output signals
-  output logic [WIDTH-1:0]       result_o,
-  output fpnew_pkg::status_t     status_o,
-  output logic                   extension_bit_o,
-  output TagType                 tag_o,
-  output AuxType                 aux_o,
+  output logic [WIDTH-1:0]        result_o,
+  output fpnew_pkg::status_t      status_o,
+  output logic                    extension_bit_o,
+  output TagType                  tag_o,
+  output AuxType                  aux_o,
   // Output handshake
-  output logic                   out_valid_o,
-  input  logic                   out_ready_i,
+  output logic                    out_valid_o,
+  input  logic                    out_ready_i,
   // Indication of valid data in flight
-  output logic                   busy_o
+  output logic                    busy_o
 );
 
   // ----------
@@ -70,14 +76,19 @@ module fpnew_cast_multi #(
   localparam int unsigned SUPER_MAN_BITS = SUPER_FORMAT.man_bits;
   localparam int unsigned SUPER_BIAS     = 2**(SUPER_EXP_BITS - 1) - 1;
 
+  // Formats without subnormal support read subnormal inputs as zero and flush tiny results to zero.
+  // Disabled formats count as flushing, so the subnormal datapath is dropped if all enabled do.
+  localparam fpnew_pkg::fmt_logic_t FTZ_FORMATS = FtzFmtConfig | ~FpFmtConfig;
+
   // The internal mantissa includes normal bit or an entire integer
   localparam int unsigned INT_MAN_WIDTH = fpnew_pkg::maximum(SUPER_MAN_BITS + 1, MAX_INT_WIDTH);
   // If needed, there will be a LZC for renormalization
   localparam int unsigned LZC_RESULT_WIDTH = $clog2(INT_MAN_WIDTH);
-  // The internal exponent must be able to represent the smallest denormal input value as signed
-  // or the number of bits in an integer
+  // The internal exponent must be able to represent the smallest denormal input value as signed,
+  // the number of bits in an integer or MX block scaled exponents
   localparam int unsigned INT_EXP_WIDTH = fpnew_pkg::maximum($clog2(MAX_INT_WIDTH),
-      fpnew_pkg::maximum(SUPER_EXP_BITS, $clog2(SUPER_BIAS + SUPER_MAN_BITS))) + 1;
+      fpnew_pkg::maximum(fpnew_pkg::maximum(SUPER_EXP_BITS, $clog2(SUPER_BIAS + SUPER_MAN_BITS)),
+                         fpnew_pkg::MX_SCALE_BITS)) + 2;
   // Pipelines
   localparam NUM_INP_REGS = PipeConfig == fpnew_pkg::BEFORE
                             ? NumPipeRegs
@@ -117,22 +128,24 @@ module fpnew_cast_multi #(
   fpnew_pkg::int_format_e [0:NUM_INP_REGS]                  inp_pipe_int_fmt_q;
   TagType                 [0:NUM_INP_REGS]                  inp_pipe_tag_q;
   AuxType                 [0:NUM_INP_REGS]                  inp_pipe_aux_q;
+  fpnew_pkg::mx_scales_t  [0:NUM_INP_REGS]                  inp_pipe_mx_scales_q;
   logic                   [0:NUM_INP_REGS]                  inp_pipe_valid_q;
   // Ready signal is combinatorial for all stages
   logic [0:NUM_INP_REGS] inp_pipe_ready;
 
   // Input stage: First element of pipeline is taken from inputs
-  assign inp_pipe_operands_q[0] = operands_i;
-  assign inp_pipe_is_boxed_q[0] = is_boxed_i;
-  assign inp_pipe_rnd_mode_q[0] = rnd_mode_i;
-  assign inp_pipe_op_q[0]       = op_i;
-  assign inp_pipe_op_mod_q[0]   = op_mod_i;
-  assign inp_pipe_src_fmt_q[0]  = src_fmt_i;
-  assign inp_pipe_dst_fmt_q[0]  = dst_fmt_i;
-  assign inp_pipe_int_fmt_q[0]  = int_fmt_i;
-  assign inp_pipe_tag_q[0]      = tag_i;
-  assign inp_pipe_aux_q[0]      = aux_i;
-  assign inp_pipe_valid_q[0]    = in_valid_i;
+  assign inp_pipe_operands_q[0]  = operands_i;
+  assign inp_pipe_is_boxed_q[0]  = is_boxed_i;
+  assign inp_pipe_rnd_mode_q[0]  = rnd_mode_i;
+  assign inp_pipe_op_q[0]        = op_i;
+  assign inp_pipe_op_mod_q[0]    = op_mod_i;
+  assign inp_pipe_src_fmt_q[0]   = src_fmt_i;
+  assign inp_pipe_dst_fmt_q[0]   = dst_fmt_i;
+  assign inp_pipe_int_fmt_q[0]   = int_fmt_i;
+  assign inp_pipe_tag_q[0]       = tag_i;
+  assign inp_pipe_aux_q[0]       = aux_i;
+  assign inp_pipe_mx_scales_q[0] = mx_scales_i;
+  assign inp_pipe_valid_q[0]     = in_valid_i;
   // Input stage: Propagate pipeline ready signal to updtream circuitry
   assign in_ready_o = inp_pipe_ready[0];
   // Generate the register stages
@@ -148,16 +161,17 @@ module fpnew_cast_multi #(
     // Enable register if pipleine ready and a valid data item is present
     assign reg_ena = inp_pipe_ready[i] & inp_pipe_valid_q[i];
     // Generate the pipeline registers within the stages, use enable-registers
-    `FFL(inp_pipe_operands_q[i+1], inp_pipe_operands_q[i], reg_ena, '0)
-    `FFL(inp_pipe_is_boxed_q[i+1], inp_pipe_is_boxed_q[i], reg_ena, '0)
-    `FFL(inp_pipe_rnd_mode_q[i+1], inp_pipe_rnd_mode_q[i], reg_ena, fpnew_pkg::RNE)
-    `FFL(inp_pipe_op_q[i+1],       inp_pipe_op_q[i],       reg_ena, fpnew_pkg::FMADD)
-    `FFL(inp_pipe_op_mod_q[i+1],   inp_pipe_op_mod_q[i],   reg_ena, '0)
-    `FFL(inp_pipe_src_fmt_q[i+1],  inp_pipe_src_fmt_q[i],  reg_ena, fpnew_pkg::fp_format_e'(0))
-    `FFL(inp_pipe_dst_fmt_q[i+1],  inp_pipe_dst_fmt_q[i],  reg_ena, fpnew_pkg::fp_format_e'(0))
-    `FFL(inp_pipe_int_fmt_q[i+1],  inp_pipe_int_fmt_q[i],  reg_ena, fpnew_pkg::int_format_e'(0))
-    `FFL(inp_pipe_tag_q[i+1],      inp_pipe_tag_q[i],      reg_ena, TagType'('0))
-    `FFL(inp_pipe_aux_q[i+1],      inp_pipe_aux_q[i],      reg_ena, AuxType'('0))
+    `FFL(inp_pipe_operands_q[i+1],  inp_pipe_operands_q[i],  reg_ena, '0)
+    `FFL(inp_pipe_is_boxed_q[i+1],  inp_pipe_is_boxed_q[i],  reg_ena, '0)
+    `FFL(inp_pipe_rnd_mode_q[i+1],  inp_pipe_rnd_mode_q[i],  reg_ena, fpnew_pkg::RNE)
+    `FFL(inp_pipe_op_q[i+1],        inp_pipe_op_q[i],        reg_ena, fpnew_pkg::FMADD)
+    `FFL(inp_pipe_op_mod_q[i+1],    inp_pipe_op_mod_q[i],    reg_ena, '0)
+    `FFL(inp_pipe_src_fmt_q[i+1],   inp_pipe_src_fmt_q[i],   reg_ena, fpnew_pkg::fp_format_e'(0))
+    `FFL(inp_pipe_dst_fmt_q[i+1],   inp_pipe_dst_fmt_q[i],   reg_ena, fpnew_pkg::fp_format_e'(0))
+    `FFL(inp_pipe_int_fmt_q[i+1],   inp_pipe_int_fmt_q[i],   reg_ena, fpnew_pkg::int_format_e'(0))
+    `FFL(inp_pipe_tag_q[i+1],       inp_pipe_tag_q[i],       reg_ena, TagType'('0))
+    `FFL(inp_pipe_aux_q[i+1],       inp_pipe_aux_q[i],       reg_ena, AuxType'('0))
+    `FFL(inp_pipe_mx_scales_q[i+1], inp_pipe_mx_scales_q[i], reg_ena, fpnew_pkg::MX_NO_SCALE)
   end
   // Output stage: assign selected pipe outputs to signals for later use
   assign operands_q = inp_pipe_operands_q[NUM_INP_REGS];
@@ -194,21 +208,29 @@ module fpnew_cast_multi #(
     localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
     localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
     localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam logic        FTZ      = FtzFmtConfig[fmt];
 
     if (FpFmtConfig[fmt]) begin : active_format
+      logic [FP_WIDTH-1:0] trimmed_op;
+
+      // Subnormal inputs of formats flushing to zero are zeroes of the same sign (DAZ)
+      assign trimmed_op = (FTZ && (operands_q[MAN_BITS+:EXP_BITS] == '0))
+                          ? {operands_q[FP_WIDTH-1], (FP_WIDTH-1)'('0)}
+                          : operands_q[FP_WIDTH-1:0];
+
       // Classify input
       fpnew_classifier #(
         .FpFormat    ( fpnew_pkg::fp_format_e'(fmt) ),
         .NumOperands ( 1                            )
       ) i_fpnew_classifier (
-        .operands_i ( operands_q[FP_WIDTH-1:0] ),
-        .is_boxed_i ( is_boxed_q[fmt]          ),
-        .info_o     ( info[fmt]                )
+        .operands_i ( trimmed_op      ),
+        .is_boxed_i ( is_boxed_q[fmt] ),
+        .info_o     ( info[fmt]       )
       );
 
-      assign fmt_sign[fmt]     = operands_q[FP_WIDTH-1];
-      assign fmt_exponent[fmt] = signed'({1'b0, operands_q[MAN_BITS+:EXP_BITS]});
-      assign fmt_mantissa[fmt] = {info[fmt].is_normal, operands_q[MAN_BITS-1:0]}; // zero pad
+      assign fmt_sign[fmt]     = trimmed_op[FP_WIDTH-1];
+      assign fmt_exponent[fmt] = signed'({1'b0, trimmed_op[MAN_BITS+:EXP_BITS]});
+      assign fmt_mantissa[fmt] = {info[fmt].is_normal, trimmed_op[MAN_BITS-1:0]}; // zero pad
       // Compensation for the difference in mantissa widths used for leading-zero count
       assign fmt_shift_compensation[fmt] = signed'(INT_MAN_WIDTH - 1 - MAN_BITS);
     end else begin : inactive_format
@@ -291,10 +313,34 @@ module fpnew_cast_multi #(
 
   assign input_exp     = src_is_int ? int_input_exp : fp_input_exp;
 
+  // -----------------
+  // MX block scaling
+  // -----------------
+  logic signed [INT_EXP_WIDTH-1:0] scale_offset; // exponent added to the converted value
+  logic                            scale_is_nan;
+  fpnew_pkg::fp_info_t             src_info;     // NaN if the block scale is NaN
+
+  // Conversions between FP formats multiply the value by the block scale of the operand, such that
+  // MX elements are converted to and from their scaled values
+  always_comb begin : mx_scaling
+    logic [fpnew_pkg::MX_SCALE_BITS-1:0] scale;
+    scale        = inp_pipe_mx_scales_q[NUM_INP_REGS][0];
+    scale_offset = signed'(INT_EXP_WIDTH'(scale))
+                   - signed'(INT_EXP_WIDTH'(fpnew_pkg::MX_SCALE_BIAS));
+    scale_is_nan = (scale == '1);
+    src_info     = info[src_fmt_q];
+    if (src_is_int || dst_is_int) begin
+      scale_offset = '0;
+      scale_is_nan = 1'b0;
+    end
+    // A NaN block scale makes all elements of the block quiet NaNs
+    if (scale_is_nan) src_info = '{is_nan: 1'b1, is_quiet: 1'b1, is_boxed: 1'b1, default: 1'b0};
+  end
+
   logic signed [INT_EXP_WIDTH-1:0] destination_exp;  // re-biased exponent for destination
 
-  // Rebias the exponent
-  assign destination_exp = input_exp + signed'(fpnew_pkg::bias(dst_fmt_q));
+  // Rebias the exponent and apply the block scale
+  assign destination_exp = input_exp + signed'(fpnew_pkg::bias(dst_fmt_q)) + scale_offset;
 
   // ---------------
   // Internal pipeline
@@ -342,7 +388,7 @@ module fpnew_cast_multi #(
   assign mid_pipe_dest_exp_q[0]   = destination_exp;
   assign mid_pipe_src_is_int_q[0] = src_is_int;
   assign mid_pipe_dst_is_int_q[0] = dst_is_int;
-  assign mid_pipe_info_q[0]       = info[src_fmt_q];
+  assign mid_pipe_info_q[0]       = src_info;
   assign mid_pipe_mant_zero_q[0]  = mant_is_zero;
   assign mid_pipe_op_mod_q[0]     = op_mod_q;
   assign mid_pipe_rnd_mode_q[0]   = inp_pipe_rnd_mode_q[NUM_INP_REGS];
@@ -414,6 +460,12 @@ module fpnew_cast_multi #(
   logic [1:0] fp_round_sticky_bits, int_round_sticky_bits, round_sticky_bits;
   logic       of_before_round, uf_before_round;
 
+  logic ftz;           // the destination format flushes subnormals to zero
+  logic flush_to_zero; // tiny result flushed to zero
+
+  assign ftz           = FTZ_FORMATS[dst_fmt_q2];
+  // Without subnormals, nonzero results below the smallest normal value become signed zeroes
+  assign flush_to_zero = ftz && ~dst_is_int_q && ~mant_is_zero_q && (destination_exp_q < 1);
 
   // Perform adjustments to mantissa and exponent
   always_comb begin : cast_value
@@ -443,11 +495,15 @@ module fpnew_cast_multi #(
     // Handle FP over-/underflows
     end else begin
       // Overflow or infinities (for proper rounding)
-      if ((destination_exp_q >= signed'(2**fpnew_pkg::exp_bits(dst_fmt_q2))-1) ||
+      if ((destination_exp_q > signed'(fpnew_pkg::max_exponent(dst_fmt_q2))) ||
           (~src_is_int_q && info_q.is_inf)) begin
-        final_exp       = unsigned'(2**fpnew_pkg::exp_bits(dst_fmt_q2)-2); // largest normal value
+        final_exp       = unsigned'(fpnew_pkg::max_exponent(dst_fmt_q2)); // largest normal value
         preshift_mant   = '1;                           // largest normal value and RS bits set
         of_before_round = 1'b1;
+      // Without subnormals, underflowing values are flushed to zero
+      end else if (ftz && destination_exp_q < 1) begin
+        final_exp     = '0;
+        preshift_mant = '0;
       // Denormalize underflowing values
       end else if (destination_exp_q < 1 &&
                    destination_exp_q >= -signed'(fpnew_pkg::man_bits(dst_fmt_q2))) begin
@@ -465,6 +521,10 @@ module fpnew_cast_multi #(
 
   localparam NUM_FP_STICKY  = 2 * INT_MAN_WIDTH - SUPER_MAN_BITS - 1; // removed mantissa, 1. and R
   localparam NUM_INT_STICKY = 2 * INT_MAN_WIDTH - MAX_INT_WIDTH; // removed int and R
+  // Stochastic rounding sees the round bit and all sticky bits
+  localparam int unsigned FRAC_WIDTH = fpnew_pkg::maximum(NUM_FP_STICKY, NUM_INT_STICKY) + 1;
+
+  logic [FRAC_WIDTH-1:0] fp_round_fraction, int_round_fraction, round_fraction;
 
   // Mantissa adjustment shift
   assign destination_mant = preshift_mant >> denorm_shamt;
@@ -479,6 +539,16 @@ module fpnew_cast_multi #(
   // select RS bits for destination operation
   assign round_sticky_bits = dst_is_int_q ? int_round_sticky_bits : fp_round_sticky_bits;
 
+  // The fractions below the rounding point are left-aligned for stochastic rounding
+  assign fp_round_fraction  = FRAC_WIDTH'(destination_mant[NUM_FP_STICKY:0])
+                              << (FRAC_WIDTH - NUM_FP_STICKY - 1);
+  assign int_round_fraction = FRAC_WIDTH'(destination_mant[NUM_INT_STICKY:0])
+                              << (FRAC_WIDTH - NUM_INT_STICKY - 1);
+  // Stochastic rounding never rounds overflows up, integer overflows have special results anyway
+  assign round_fraction     = of_before_round ? '0
+                              : dst_is_int_q  ? int_round_fraction
+                              : fp_round_fraction;
+
   // ----------------------------
   // Rounding and classification
   // ----------------------------
@@ -499,6 +569,8 @@ module fpnew_cast_multi #(
   logic [WIDTH-1:0] rounded_int_res; // after possible inversion
   logic             rounded_int_res_zero; // after rounding
 
+  logic [fpnew_pkg::SR_BITS-1:0] sr_random; // random bits for stochastic rounding
+
 
   // Pack exponent and mantissa into proper rounding form
   for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_res_assemble
@@ -535,13 +607,16 @@ module fpnew_cast_multi #(
   assign pre_round_abs = dst_is_int_q ? ifmt_pre_round_abs[int_fmt_q2] : fmt_pre_round_abs[dst_fmt_q2];
 
   fpnew_rounding #(
-    .AbsWidth ( WIDTH )
+    .AbsWidth  ( WIDTH      ),
+    .FracWidth ( FRAC_WIDTH )
   ) i_fpnew_rounding (
     .abs_value_i             ( pre_round_abs     ),
     .sign_i                  ( input_sign_q      ), // source format
     .round_sticky_bits_i     ( round_sticky_bits ),
     .rnd_mode_i              ( rnd_mode_q        ),
     .effective_subtraction_i ( 1'b0              ), // no operation happened
+    .fraction_i              ( round_fraction    ),
+    .random_i                ( sr_random         ),
     .abs_rounded_o           ( rounded_abs       ),
     .sign_o                  ( rounded_sign      ),
     .exact_zero_o            ( result_true_zero  )
@@ -555,18 +630,30 @@ module fpnew_cast_multi #(
     localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
     localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
     localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam logic        NO_INF   = fpnew_pkg::NO_INF_FORMATS[fmt];
+    localparam logic [EXP_BITS-1:0] MAX_EXPONENT =
+        fpnew_pkg::max_exponent(fpnew_pkg::fp_format_e'(fmt));
+    localparam logic [MAN_BITS-1:0] MAX_MANTISSA =
+        fpnew_pkg::max_mantissa(fpnew_pkg::fp_format_e'(fmt));
 
     if (FpFmtConfig[fmt]) begin : active_format
       always_comb begin : post_process
         // detect of / uf
         fmt_uf_after_round[fmt] = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '0; // denormal
-        fmt_of_after_round[fmt] = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '1; // inf exp.
+        if (NO_INF) // on the NaN encoding or carried beyond it
+          fmt_of_after_round[fmt] = (rounded_abs[EXP_BITS+MAN_BITS-1:0] == '1) ||
+                                    rounded_abs[EXP_BITS+MAN_BITS];
+        else
+          fmt_of_after_round[fmt] = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '1; // inf exp.
 
         // Assemble regular result, nan box short ones. Int zeroes need to be detected`
         fmt_result[fmt]               = '1;
         fmt_result[fmt][FP_WIDTH-1:0] = src_is_int_q & mant_is_zero_q
                                         ? '0
                                         : {rounded_sign, rounded_abs[EXP_BITS+MAN_BITS-1:0]};
+        // Formats without infinities saturate to their largest finite value
+        if (NO_INF && fmt_of_after_round[fmt])
+          fmt_result[fmt][FP_WIDTH-1:0] = {rounded_sign, MAX_EXPONENT, MAX_MANTISSA};
       end
     end else begin : inactive_format
       assign fmt_uf_after_round[fmt] = fpnew_pkg::DONT_CARE;
@@ -600,14 +687,23 @@ module fpnew_cast_multi #(
     localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
 
     localparam logic [EXP_BITS-1:0] QNAN_EXPONENT = '1;
-    localparam logic [MAN_BITS-1:0] QNAN_MANTISSA = 2**(MAN_BITS-1);
+    localparam logic [MAN_BITS-1:0] QNAN_MANTISSA =
+        fpnew_pkg::qnan_mantissa(fpnew_pkg::fp_format_e'(fmt));
+    // Formats without infinities saturate to their largest finite value instead
+    localparam logic [EXP_BITS+MAN_BITS-1:0] INF_ABS =
+        fpnew_pkg::NO_INF_FORMATS[fmt]
+        ? {EXP_BITS'(fpnew_pkg::max_exponent(fpnew_pkg::fp_format_e'(fmt))),
+           MAN_BITS'(fpnew_pkg::max_mantissa(fpnew_pkg::fp_format_e'(fmt)))}
+        : {QNAN_EXPONENT, MAN_BITS'('0)};
 
     if (FpFmtConfig[fmt]) begin : active_format
       always_comb begin : special_results
         logic [FP_WIDTH-1:0] special_res;
         special_res = info_q.is_zero
                       ? input_sign_q << FP_WIDTH-1 // signed zero
-                      : {1'b0, QNAN_EXPONENT, QNAN_MANTISSA}; // qNaN
+                      : info_q.is_inf
+                        ? {input_sign_q, INF_ABS} // signed infinity
+                        : {1'b0, QNAN_EXPONENT, QNAN_MANTISSA}; // qNaN
 
         // Initialize special result with ones (NaN-box)
         fmt_special_result[fmt]               = '1;
@@ -618,8 +714,11 @@ module fpnew_cast_multi #(
     end
   end
 
-  // Detect special case from source format, I2F casts don't produce a special result
+  // Detect special case from source format, I2F casts don't produce a special result. Infinities
+  // are passed through instead of being rounded, which would yield the largest normal value in the
+  // directed rounding modes and round-to-odd
   assign fp_result_is_special = ~src_is_int_q & (info_q.is_zero |
+                                                 info_q.is_inf |
                                                  info_q.is_nan |
                                                  ~info_q.is_boxed);
 
@@ -686,9 +785,10 @@ module fpnew_cast_multi #(
   assign fp_regular_status.NV = src_is_int_q & (of_before_round | of_after_round); // overflow is invalid for I2F casts
   assign fp_regular_status.DZ = 1'b0; // no divisions
   assign fp_regular_status.OF = ~src_is_int_q & (~info_q.is_inf & (of_before_round | of_after_round)); // inf casts no OF
-  assign fp_regular_status.UF = uf_after_round & fp_regular_status.NX;
+  assign fp_regular_status.UF = ftz ? flush_to_zero : (uf_after_round & fp_regular_status.NX);
   assign fp_regular_status.NX = src_is_int_q ? (| fp_round_sticky_bits) // overflow is invalid in i2f
-            : (| fp_round_sticky_bits) | (~info_q.is_inf & (of_before_round | of_after_round));
+            : (| fp_round_sticky_bits) | (~info_q.is_inf & (of_before_round | of_after_round))
+              | flush_to_zero;
   assign int_regular_status = '{NX: (| int_round_sticky_bits), default: 1'b0};
 
   assign fp_result  = fp_result_is_special  ? fp_special_result  : fmt_result[dst_fmt_q2];
@@ -759,4 +859,26 @@ module fpnew_cast_multi #(
   assign aux_o           = out_pipe_aux_q[NUM_OUT_REGS];
   assign out_valid_o     = out_pipe_valid_q[NUM_OUT_REGS];
   assign busy_o          = (| {inp_pipe_valid_q, mid_pipe_valid_q, out_pipe_valid_q});
+
+  // --------------------
+  // Stochastic rounding
+  // --------------------
+  logic                    sr_draw; // a stochastically rounded result enters the output pipeline
+  logic [SR_SEED_BITS-1:0] lfsr_random;
+
+  assign sr_draw = out_pipe_valid_q[0] & out_pipe_ready[0] & (rnd_mode_q == fpnew_pkg::RSR);
+
+  // A new random value is drawn for each stochastically rounded result
+  fpnew_lfsr #(
+    .ResetState ( SrResetState )
+  ) i_lfsr (
+    .clk_i,
+    .rst_ni,
+    .seed_i   ( sr_seed_i      ),
+    .load_i   ( sr_seed_load_i ),
+    .en_i     ( sr_draw        ),
+    .random_o ( lfsr_random    )
+  );
+
+  assign sr_random = lfsr_random[fpnew_pkg::SR_BITS-1:0];
 endmodule
@@ -26,6 +26,8 @@ module fpnew_classifier #(
 
   localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(FpFormat);
   localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(FpFormat);
+  // Formats without infinities only use the all-ones exponent and mantissa for their single NaN
+  localparam logic NO_INF = fpnew_pkg::NO_INF_FORMATS[FpFormat];
 
   // Type definition
   typedef struct packed {
@@ -46,6 +48,7 @@ module fpnew_classifier #(
     logic is_quiet;
     logic is_zero;
     logic is_subnormal;
+    logic is_special; // encodes infinity or NaN
 
     // ---------------
     // Classify Input
@@ -53,12 +56,14 @@ module fpnew_classifier #(
     always_comb begin : classify_input
       value         = operands_i[op];
       is_boxed      = is_boxed_i[op];
-      is_normal     = is_boxed && (value.exponent != '0) && (value.exponent != '1);
+      is_special    = (value.exponent == '1) && (!NO_INF || (value.mantissa == '1));
+      is_normal     = is_boxed && (value.exponent != '0) && !is_special;
       is_zero       = is_boxed && (value.exponent == '0) && (value.mantissa == '0);
       is_subnormal  = is_boxed && (value.exponent == '0) && !is_zero;
-      is_inf        = is_boxed && ((value.exponent == '1) && (value.mantissa == '0));
-      is_nan        = !is_boxed || ((value.exponent == '1) && (value.mantissa != '0));
-      is_signalling = is_boxed && is_nan && (value.mantissa[MAN_BITS-1] == 1'b0);
+      is_inf        = is_boxed && is_special && !NO_INF && (value.mantissa == '0);
+      is_nan        = !is_boxed || (is_special && (NO_INF || (value.mantissa != '0)));
+      // The single NaN of formats without infinities is quiet
+      is_signalling = is_boxed && is_nan && !NO_INF && (value.mantissa[MAN_BITS-1] == 1'b0);
       is_quiet      = is_nan && !is_signalling;
       // Assign output for current input
       info_o[op].is_normal     = is_normal;
@@ -0,0 +1,129 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License. You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+//
+// SPDX-License-Identifier: SHL-0.51
+
+// Author: agent <agent@local>
+
+`include "common_cells/registers.svh"
+
+// Tree of 3:2 compressors reducing a number of rows to two rows of the same sum (modulo 2**Width).
+// Pipeline registers are spread evenly over the inputs and the compressor levels. They hold no
+// valid bits, the enables are driven by the pipeline control of the instantiating unit.
+module fpnew_compressor_tree #(
+  parameter int unsigned Width       = 48,
+  parameter int unsigned NumRows     = 3, // at least 3
+  parameter int unsigned NumPipeRegs = 0,
+
+  localparam int unsigned NUM_ENA = fpnew_pkg::maximum(NumPipeRegs, 1) // do not change
+) (
+  input  logic                          clk_i,
+  input  logic                          rst_ni,
+  // Rows to be added
+  input  logic [NumRows-1:0][Width-1:0] rows_i,
+  // Register enables, one per pipeline stage in order
+  input  logic [NUM_ENA-1:0]            reg_ena_i,
+  // Sum in carry-save form
+  output logic [Width-1:0]              sum_o,
+  output logic [Width-1:0]              carry_o
+);
+
+  // ----------
+  // Constants
+  // ----------
+  // Number of rows left after the given number of compressor levels
+  function automatic int unsigned rows_after(int unsigned levels);
+    automatic int unsigned rows = NumRows;
+    for (int unsigned i = 0; i < levels; i++) rows = 2 * (rows / 3) + rows % 3;
+    return rows;
+  endfunction
+
+  // Number of compressor levels needed to reduce the rows to two
+  function automatic int unsigned num_levels();
+    automatic int unsigned levels = 0;
+    for (int unsigned i = 0; i < NumRows; i++)
+      if (rows_after(i) > 2) levels = i + 1;
+    return levels;
+  endfunction
+
+  localparam int unsigned NUM_LEVELS = num_levels();
+
+  // Number of pipeline registers behind the given level, level 0 are the inputs
+  function automatic int unsigned regs_after(int unsigned level);
+    automatic int unsigned regs = 0;
+    for (int unsigned i = 1; i <= NumPipeRegs; i++)
+      if ((i * (NUM_LEVELS + 1)) / (NumPipeRegs + 1) == level) regs++;
+    return regs;
+  endfunction
+
+  // Number of pipeline registers behind all levels before the given one
+  function automatic int unsigned regs_before(int unsigned level);
+    automatic int unsigned regs = 0;
+    for (int unsigned i = 0; i < level; i++) regs += regs_after(i);
+    return regs;
+  endfunction
+
+  // Rows entering the pipeline registers behind each level, and leaving them
+  logic [NUM_LEVELS:0][NumRows-1:0][Width-1:0] level_rows, level_rows_q;
+
+  assign level_rows[0] = rows_i;
+
+  // ----------------
+  // Compressor tree
+  // ----------------
+  for (genvar l = 0; l < int'(NUM_LEVELS); l++) begin : gen_compressor_levels
+    localparam int unsigned IN_ROWS = rows_after(l);
+    localparam int unsigned NUM_CSA = IN_ROWS / 3;
+
+    // Each group of three rows is compressed into a sum row and a carry row
+    for (genvar c = 0; c < int'(NUM_CSA); c++) begin : gen_compressors
+      logic [Width-1:0] row_x, row_y, row_z;
+
+      assign row_x = level_rows_q[l][3*c];
+      assign row_y = level_rows_q[l][3*c+1];
+      assign row_z = level_rows_q[l][3*c+2];
+
+      assign level_rows[l+1][2*c]   = row_x ^ row_y ^ row_z;
+      assign level_rows[l+1][2*c+1] = ((row_x & row_y) | (row_x & row_z) | (row_y & row_z)) << 1;
+    end
+
+    // Remaining rows move on to the next level, unused rows are zero
+    for (genvar r = 3 * NUM_CSA; r < int'(IN_ROWS); r++) begin : gen_remaining_rows
+      assign level_rows[l+1][r-NUM_CSA] = level_rows_q[l][r];
+    end
+    for (genvar r = IN_ROWS - NUM_CSA; r < int'(NumRows); r++) begin : gen_unused_rows
+      assign level_rows[l+1][r] = '0;
+    end
+  end
+
+  // ------------------
+  // Pipeline registers
+  // ------------------
+  for (genvar l = 0; l <= int'(NUM_LEVELS); l++) begin : gen_level_pipeline
+    localparam int unsigned NUM_REGS  = regs_after(l);
+    localparam int unsigned FIRST_REG = regs_before(l);
+
+    // Pipeline signals, index i holds the rows after i register stages
+    logic [0:NUM_REGS][NumRows-1:0][Width-1:0] pipe_rows_q;
+
+    assign pipe_rows_q[0] = level_rows[l];
+    // Generate the register stages, enabled by the stage of the instantiating unit
+    for (genvar i = 0; i < int'(NUM_REGS); i++) begin : gen_pipeline
+      `FFL(pipe_rows_q[i+1], pipe_rows_q[i], reg_ena_i[FIRST_REG+i], '0)
+    end
+    assign level_rows_q[l] = pipe_rows_q[NUM_REGS];
+  end
+
+  // The two rows left after the last level hold the sum
+  assign sum_o   = level_rows_q[NUM_LEVELS][0];
+  assign carry_o = level_rows_q[NUM_LEVELS][1];
+
+endmodule
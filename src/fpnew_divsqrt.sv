@@ -0,0 +1,265 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License. You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+//
+// SPDX-License-Identifier: SHL-0.51
+
+// Author: agent <agent@local>
+
+`include "common_cells/registers.svh"
+
+module fpnew_divsqrt #(
+  parameter fpnew_pkg::fp_format_e   FpFormat         = fpnew_pkg::fp_format_e'(0),
+  parameter int unsigned             NumPipeRegs      = 0,
+  parameter fpnew_pkg::pipe_config_t PipeConfig       = fpnew_pkg::BEFORE,
+  parameter type                     TagType          = logic,
+  parameter type                     AuxType          = logic,
+  parameter int unsigned             StepsPerCycle    = 1, // radix-2 steps (result bits) per cycle
+  // Precision in bits including the implicit bit if op_mod_i is set, 0 for full precision
+  parameter int unsigned             ReducedPrecision = 0,
+
+  localparam int unsigned WIDTH = fpnew_pkg::fp_width(FpFormat) // do not change
+) (
+  input logic                      clk_i,
+  input logic                      rst_ni,
+  // Input signals
+  input logic [1:0][WIDTH-1:0]     operands_i, // 2 operands
+  input logic [1:0]                is_boxed_i, // 2 operands
+  input fpnew_pkg::roundmode_e     rnd_mode_i,
+  input fpnew_pkg::operation_e     op_i,
+  input logic                      op_mod_i,
+  input TagType                    tag_i,
+  input AuxType                    aux_i,
+  // Input Handshake
+  input  logic                     in_valid_i,
+  output logic                     in_ready_o,
+  input  logic                     flush_i,
+  // Output signals
+  output logic [WIDTH-1:0]         result_o,
+  output fpnew_pkg::status_t       status_o,
+  output logic                     extension_bit_o,
+  output TagType                   tag_o,
+  output AuxType                   aux_o,
+  // Output handshake
+  output logic                     out_valid_o,
+  input  logic                     out_ready_i,
+  // Indication of valid data in flight
+  output logic                     busy_o
+);
+
+  // ----------
+  // Constants
+  // ----------
+  // Only FpFormat is enabled in the recurrence (format bits are in ascending order)
+  localparam fpnew_pkg::fmt_logic_t FMT_CONFIG = 1 << (fpnew_pkg::NUM_FP_FORMATS - 1 - FpFormat);
+  // Pipelines
+  localparam NUM_INP_REGS = (PipeConfig == fpnew_pkg::BEFORE)
+                            ? NumPipeRegs
+                            : (PipeConfig == fpnew_pkg::DISTRIBUTED
+                               ? (NumPipeRegs / 2) // Last to get distributed regs
+                               : 0); // no regs here otherwise
+  localparam NUM_OUT_REGS = (PipeConfig == fpnew_pkg::AFTER || PipeConfig == fpnew_pkg::INSIDE)
+                            ? NumPipeRegs
+                            : (PipeConfig == fpnew_pkg::DISTRIBUTED
+                               ? ((NumPipeRegs + 1) / 2) // First to get distributed regs
+                               : 0); // no regs here otherwise
+
+  // ---------------
+  // Input pipeline
+  // ---------------
+  // Input pipeline signals, index i holds signal after i register stages
+  logic                  [0:NUM_INP_REGS][1:0][WIDTH-1:0] inp_pipe_operands_q;
+  logic                  [0:NUM_INP_REGS][1:0]            inp_pipe_is_boxed_q;
+  fpnew_pkg::roundmode_e [0:NUM_INP_REGS]                 inp_pipe_rnd_mode_q;
+  fpnew_pkg::operation_e [0:NUM_INP_REGS]                 inp_pipe_op_q;
+  logic                  [0:NUM_INP_REGS]                 inp_pipe_op_mod_q;
+  TagType                [0:NUM_INP_REGS]                 inp_pipe_tag_q;
+  AuxType                [0:NUM_INP_REGS]                 inp_pipe_aux_q;
+  logic                  [0:NUM_INP_REGS]                 inp_pipe_valid_q;
+  // Ready signal is combinatorial for all stages
+  logic [0:NUM_INP_REGS] inp_pipe_ready;
+
+  // Input stage: First element of pipeline is taken from inputs
+  assign inp_pipe_operands_q[0] = operands_i;
+  assign inp_pipe_is_boxed_q[0] = is_boxed_i;
+  assign inp_pipe_rnd_mode_q[0] = rnd_mode_i;
+  assign inp_pipe_op_q[0]       = op_i;
+  assign inp_pipe_op_mod_q[0]   = op_mod_i;
+  assign inp_pipe_tag_q[0]      = tag_i;
+  assign inp_pipe_aux_q[0]      = aux_i;
+  assign inp_pipe_valid_q[0]    = in_valid_i;
+  // Input stage: Propagate pipeline ready signal to updtream circuitry
+  assign in_ready_o = inp_pipe_ready[0];
+  // Generate the register stages
+  for (genvar i = 0; i < NUM_INP_REGS; i++) begin : gen_input_pipeline
+    // Internal register enable for this stage
+    logic reg_ena;
+    // Determine the ready signal of the current stage - advance the pipeline:
+    // 1. if the next stage is ready for our data
+    // 2. if the next stage only holds a bubble (not valid) -> we can pop it
+    assign inp_pipe_ready[i] = inp_pipe_ready[i+1] | ~inp_pipe_valid_q[i+1];
+    // Valid: enabled by ready signal, synchronous clear with the flush signal
+    `FFLARNC(inp_pipe_valid_q[i+1], inp_pipe_valid_q[i], inp_pipe_ready[i], flush_i, 1'b0, clk_i, rst_ni)
+    // Enable register if pipleine ready and a valid data item is present
+    assign reg_ena = inp_pipe_ready[i] & inp_pipe_valid_q[i];
+    // Generate the pipeline registers within the stages, use enable-registers
+    `FFL(inp_pipe_operands_q[i+1], inp_pipe_operands_q[i], reg_ena, '0)
+    `FFL(inp_pipe_is_boxed_q[i+1], inp_pipe_is_boxed_q[i], reg_ena, '0)
+    `FFL(inp_pipe_rnd_mode_q[i+1], inp_pipe_rnd_mode_q[i], reg_ena, fpnew_pkg::RNE)
+    `FFL(inp_pipe_op_q[i+1],       inp_pipe_op_q[i],       reg_ena, fpnew_pkg::FMADD)
+    `FFL(inp_pipe_op_mod_q[i+1],   inp_pipe_op_mod_q[i],   reg_ena, '0)
+    `FFL(inp_pipe_tag_q[i+1],      inp_pipe_tag_q[i],      reg_ena, TagType'('0))
+    `FFL(inp_pipe_aux_q[i+1],      inp_pipe_aux_q[i],      reg_ena, AuxType'('0))
+  end
+
+  // ------------
+  // Control FSM
+  // ------------
+  logic in_ready;             // input handshake with upstream
+  logic op_starting;          // high in the cycle a new operation starts
+  logic unit_done;            // the recurrence holds a finished result
+  logic out_valid, out_ready; // output handshake with downstream
+  logic unit_busy;            // valid data in flight
+  // FSM states
+  typedef enum logic {IDLE, BUSY} fsm_state_e;
+  fsm_state_e state_q, state_d;
+
+  // Upstream ready comes from the FSM
+  assign inp_pipe_ready[NUM_INP_REGS] = in_ready;
+  assign op_starting = inp_pipe_valid_q[NUM_INP_REGS] & in_ready & ~flush_i;
+
+  // The recurrence takes the same number of cycles for all operands, so vectorial lanes stay in
+  // lock-step. The result is kept in the recurrence registers until it is accepted downstream.
+  always_comb begin : iteration_fsm
+    // Default assignments
+    in_ready  = 1'b0;
+    out_valid = 1'b0;
+    unit_busy = 1'b0;
+    state_d   = state_q;
+
+    unique case (state_q)
+      // Waiting for work
+      IDLE: begin
+        in_ready = 1'b1;
+        if (inp_pipe_valid_q[NUM_INP_REGS]) state_d = BUSY;
+      end
+      // Recurrence in progress or result ready for downstream
+      BUSY: begin
+        unit_busy = 1'b1;
+        if (unit_done) begin
+          out_valid = 1'b1;
+          if (out_ready) begin
+            state_d  = IDLE; // go back to idle..
+            in_ready = 1'b1; // ..unless new work comes in
+            if (inp_pipe_valid_q[NUM_INP_REGS]) state_d = BUSY;
+          end
+        end
+      end
+      // fall into idle state otherwise
+      default: state_d = IDLE;
+    endcase
+
+    // Flushing overrides the other actions
+    if (flush_i) begin
+      unit_busy = 1'b0; // data is invalidated
+      out_valid = 1'b0; // cancel any valid data
+      state_d   = IDLE; // go to default state
+    end
+  end
+
+  // FSM status registers (asynch active low reset)
+  `FF(state_q, state_d, IDLE)
+
+  // Hold the tag and aux data of the operation in progress
+  TagType result_tag_q;
+  AuxType result_aux_q;
+
+  `FFL(result_tag_q, inp_pipe_tag_q[NUM_INP_REGS], op_starting, TagType'('0))
+  `FFL(result_aux_q, inp_pipe_aux_q[NUM_INP_REGS], op_starting, AuxType'('0))
+
+  // -----------
+  // Recurrence
+  // -----------
+  logic [fpnew_pkg::NUM_FP_FORMATS-1:0][1:0] fmt_is_boxed;
+  logic [WIDTH-1:0]                          result_d;
+  fpnew_pkg::status_t                        status_d;
+
+  // Only the entry of FpFormat is used
+  assign fmt_is_boxed = {fpnew_pkg::NUM_FP_FORMATS{inp_pipe_is_boxed_q[NUM_INP_REGS]}};
+
+  fpnew_divsqrt_recurrence #(
+    .FpFmtConfig      ( FMT_CONFIG                   ),
+    .StepsPerCycle    ( StepsPerCycle                ),
+    .ReducedPrecision ( '{default: ReducedPrecision} )
+  ) i_divsqrt_recurrence (
+    .clk_i,
+    .rst_ni,
+    .operands_i     ( inp_pipe_operands_q[NUM_INP_REGS] ),
+    .is_boxed_i     ( fmt_is_boxed                      ),
+    .rnd_mode_i     ( inp_pipe_rnd_mode_q[NUM_INP_REGS] ),
+    .op_i           ( inp_pipe_op_q[NUM_INP_REGS]       ),
+    .dst_fmt_i      ( FpFormat                          ),
+    .reduced_prec_i ( inp_pipe_op_mod_q[NUM_INP_REGS]   ),
+    .start_i        ( op_starting                       ),
+    .kill_i         ( flush_i                           ),
+    .done_o         ( unit_done                         ),
+    .result_o       ( result_d                          ),
+    .status_o       ( status_d                          )
+  );
+
+  // ----------------
+  // Output Pipeline
+  // ----------------
+  // Output pipeline signals, index i holds signal after i register stages
+  logic               [0:NUM_OUT_REGS][WIDTH-1:0] out_pipe_result_q;
+  fpnew_pkg::status_t [0:NUM_OUT_REGS]            out_pipe_status_q;
+  TagType             [0:NUM_OUT_REGS]            out_pipe_tag_q;
+  AuxType             [0:NUM_OUT_REGS]            out_pipe_aux_q;
+  logic               [0:NUM_OUT_REGS]            out_pipe_valid_q;
+  // Ready signal is combinatorial for all stages
+  logic [0:NUM_OUT_REGS] out_pipe_ready;
+
+  // Input stage: First element of pipeline is taken from inputs
+  assign out_pipe_result_q[0] = result_d;
+  assign out_pipe_status_q[0] = status_d;
+  assign out_pipe_tag_q[0]    = result_tag_q;
+  assign out_pipe_aux_q[0]    = result_aux_q;
+  assign out_pipe_valid_q[0]  = out_valid;
+  // Input stage: Propagate pipeline ready signal to inside pipe
+  assign out_ready = out_pipe_ready[0];
+  // Generate the register stages
+  for (genvar i = 0; i < NUM_OUT_REGS; i++) begin : gen_output_pipeline
+    // Internal register enable for this stage
+    logic reg_ena;
+    // Determine the ready signal of the current stage - advance the pipeline:
+    // 1. if the next stage is ready for our data
+    // 2. if the next stage only holds a bubble (not valid) -> we can pop it
+    assign out_pipe_ready[i] = out_pipe_ready[i+1] | ~out_pipe_valid_q[i+1];
+    // Valid: enabled by ready signal, synchronous clear with the flush signal
+    `FFLARNC(out_pipe_valid_q[i+1], out_pipe_valid_q[i], out_pipe_ready[i], flush_i, 1'b0, clk_i, rst_ni)
+    // Enable register if pipleine ready and a valid data item is present
+    assign reg_ena = out_pipe_ready[i] & out_pipe_valid_q[i];
+    // Generate the pipeline registers within the stages, use enable-registers
+    `FFL(out_pipe_result_q[i+1], out_pipe_result_q[i], reg_ena, '0)
+    `FFL(out_pipe_status_q[i+1], out_pipe_status_q[i], reg_ena, '0)
+    `FFL(out_pipe_tag_q[i+1],    out_pipe_tag_q[i],    reg_ena, TagType'('0))
+    `FFL(out_pipe_aux_q[i+1],    out_pipe_aux_q[i],    reg_ena, AuxType'('0))
+  end
+  // Output stage: Ready travels backwards from output side, driven by downstream circuitry
+  assign out_pipe_ready[NUM_OUT_REGS] = out_ready_i;
+  // Output stage: assign module outputs
+  assign result_o        = out_pipe_result_q[NUM_OUT_REGS];
+  assign status_o        = out_pipe_status_q[NUM_OUT_REGS];
+  assign extension_bit_o = 1'b1; // always NaN-Box result
+  assign tag_o           = out_pipe_tag_q[NUM_OUT_REGS];
+  assign aux_o           = out_pipe_aux_q[NUM_OUT_REGS];
+  assign out_valid_o     = out_pipe_valid_q[NUM_OUT_REGS];
+  assign busy_o          = (| {inp_pipe_valid_q, unit_busy, out_pipe_valid_q});
+endmodule
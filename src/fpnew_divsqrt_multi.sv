@@ -16,12 +16,16 @@
 `include "common_cells/registers.svh"
 
 module fpnew_divsqrt_multi #(
-  parameter fpnew_pkg::fmt_logic_t   FpFmtConfig  = '1,
+  parameter fpnew_pkg::fmt_logic_t      FpFmtConfig      = '1,
   // FPU configuration
-  parameter int unsigned             NumPipeRegs = 0,
-  parameter fpnew_pkg::pipe_config_t PipeConfig  = fpnew_pkg::AFTER,
-  parameter type                     TagType     = logic,
-  parameter type                     AuxType     = logic,
+  parameter int unsigned                NumPipeRegs      = 0,
+  parameter fpnew_pkg::pipe_config_t    PipeConfig       = fpnew_pkg::AFTER,
+  parameter type                        TagType          = logic,
+  parameter type                        AuxType          = logic,
+  parameter int unsigned                NumUnits         = 1, // replicated units
+  parameter fpnew_pkg::divsqrt_config_t DivSqrtConfig    = fpnew_pkg::PULP_DIVSQRT,
+  // Precision in bits including the implicit bit if op_mod_i is set, 0 for full precision
+  parameter fpnew_pkg::fmt_unsigned_t   ReducedPrecision = '{default: 0},
   // Do not change
   localparam int unsigned WIDTH       = fpnew_pkg::max_fp_width(FpFmtConfig),
   localparam int unsigned NUM_FORMATS = fpnew_pkg::NUM_FP_FORMATS
@@ -33,9 +37,13 @@ module fpnew_divsqrt_multi #(
   input  logic [NUM_FORMATS-1:0][1:0] is_boxed_i, // 2 operands
   input  fpnew_pkg::roundmode_e       rnd_mode_i,
   input  fpnew_pkg::operation_e       op_i,
+  input  logic                        op_mod_i,
   input  fpnew_pkg::fp_format_e       dst_fmt_i,
   input  TagType                      tag_i,
   input  AuxType                      aux_i,
+  // Fast path for operations without iterations, must agree among vectorial lanes
+  output logic                        fast_path_o, // operation qualifies or lane is not used
+  input  logic                        fast_path_i, // all lanes qualify
   // Input Handshake
   input  logic                        in_valid_i,
   output logic                        in_ready_o,
@@ -72,16 +80,20 @@ module fpnew_divsqrt_multi #(
   // Input pipeline
   // ---------------
   // Selected pipeline output signals as non-arrays
-  logic [1:0][WIDTH-1:0] operands_q;
-  fpnew_pkg::roundmode_e rnd_mode_q;
-  fpnew_pkg::operation_e op_q;
-  fpnew_pkg::fp_format_e dst_fmt_q;
-  logic                  in_valid_q;
+  logic [1:0][WIDTH-1:0]       operands_q;
+  logic [NUM_FORMATS-1:0][1:0] is_boxed_q;
+  fpnew_pkg::roundmode_e       rnd_mode_q;
+  fpnew_pkg::operation_e       op_q;
+  logic                        op_mod_q;
+  fpnew_pkg::fp_format_e       dst_fmt_q;
+  logic                        in_valid_q;
 
   // Input pipeline signals, index i holds signal after i register stages
   logic                  [0:NUM_INP_REGS][1:0][WIDTH-1:0]       inp_pipe_operands_q;
+  logic                  [0:NUM_INP_REGS][NUM_FORMATS-1:0][1:0] inp_pipe_is_boxed_q;
   fpnew_pkg::roundmode_e [0:NUM_INP_REGS]                       inp_pipe_rnd_mode_q;
   fpnew_pkg::operation_e [0:NUM_INP_REGS]                       inp_pipe_op_q;
+  logic                  [0:NUM_INP_REGS]                       inp_pipe_op_mod_q;
   fpnew_pkg::fp_format_e [0:NUM_INP_REGS]                       inp_pipe_dst_fmt_q;
   TagType                [0:NUM_INP_REGS]                       inp_pipe_tag_q;
   AuxType                [0:NUM_INP_REGS]                       inp_pipe_aux_q;
@@ -91,8 +103,10 @@ module fpnew_divsqrt_multi #(
 
   // Input stage: First element of pipeline is taken from inputs
   assign inp_pipe_operands_q[0] = operands_i;
+  assign inp_pipe_is_boxed_q[0] = is_boxed_i;
   assign inp_pipe_rnd_mode_q[0] = rnd_mode_i;
   assign inp_pipe_op_q[0]       = op_i;
+  assign inp_pipe_op_mod_q[0]   = op_mod_i;
   assign inp_pipe_dst_fmt_q[0]  = dst_fmt_i;
   assign inp_pipe_tag_q[0]      = tag_i;
   assign inp_pipe_aux_q[0]      = aux_i;
@@ -113,16 +127,20 @@ module fpnew_divsqrt_multi #(
     assign reg_ena = inp_pipe_ready[i] & inp_pipe_valid_q[i];
     // Generate the pipeline registers within the stages, use enable-registers
     `FFL(inp_pipe_operands_q[i+1], inp_pipe_operands_q[i], reg_ena, '0)
+    `FFL(inp_pipe_is_boxed_q[i+1], inp_pipe_is_boxed_q[i], reg_ena, '0)
     `FFL(inp_pipe_rnd_mode_q[i+1], inp_pipe_rnd_mode_q[i], reg_ena, fpnew_pkg::RNE)
     `FFL(inp_pipe_op_q[i+1],       inp_pipe_op_q[i],       reg_ena, fpnew_pkg::FMADD)
+    `FFL(inp_pipe_op_mod_q[i+1],   inp_pipe_op_mod_q[i],   reg_ena, '0)
     `FFL(inp_pipe_dst_fmt_q[i+1],  inp_pipe_dst_fmt_q[i],  reg_ena, fpnew_pkg::fp_format_e'(0))
     `FFL(inp_pipe_tag_q[i+1],      inp_pipe_tag_q[i],      reg_ena, TagType'('0))
     `FFL(inp_pipe_aux_q[i+1],      inp_pipe_aux_q[i],      reg_ena, AuxType'('0))
   end
   // Output stage: assign selected pipe outputs to signals for later use
   assign operands_q = inp_pipe_operands_q[NUM_INP_REGS];
+  assign is_boxed_q = inp_pipe_is_boxed_q[NUM_INP_REGS];
   assign rnd_mode_q = inp_pipe_rnd_mode_q[NUM_INP_REGS];
   assign op_q       = inp_pipe_op_q[NUM_INP_REGS];
+  assign op_mod_q   = inp_pipe_op_mod_q[NUM_INP_REGS];
   assign dst_fmt_q  = inp_pipe_dst_fmt_q[NUM_INP_REGS];
   assign in_valid_q = inp_pipe_valid_q[NUM_INP_REGS];
 
@@ -130,6 +148,7 @@ module fpnew_divsqrt_multi #(
   // Input processing
   // -----------------
   logic [1:0]       divsqrt_fmt;
+  logic [5:0]       divsqrt_precision; // precision in bits, 0 for full precision
   logic [1:0][63:0] divsqrt_operands; // those are fixed to 64bit
   logic             input_is_fp8;
 
@@ -143,6 +162,12 @@ module fpnew_divsqrt_multi #(
       default:            divsqrt_fmt = 2'b10; // maps also FP8 to FP16
     endcase
 
+    // Reduced-precision operations pass their precision to the unit
+    divsqrt_precision = '0;
+    if (op_mod_q && ReducedPrecision[dst_fmt_q] != 0 &&
+        ReducedPrecision[dst_fmt_q] <= fpnew_pkg::man_bits(dst_fmt_q))
+      divsqrt_precision = 6'(ReducedPrecision[dst_fmt_q]);
+
     // Only if FP8 is enabled
     input_is_fp8 = FpFmtConfig[fpnew_pkg::FP8] & (dst_fmt_q == fpnew_pkg::FP8);
 
@@ -151,145 +176,380 @@ module fpnew_divsqrt_multi #(
     divsqrt_operands[1] = input_is_fp8 ? operands_q[1] << 8 : operands_q[1];
   end
 
-  // ------------
-  // Control FSM
-  // ------------
+  // ----------
+  // Fast Path
+  // ----------
+  // Special operands and divisions of normal numbers by powers of two without under- or overflow
+  // need no iterations. Their results are returned from a separate register after one cycle,
+  // ahead of the operations in the units.
+  logic [NUM_FORMATS-1:0]               fmt_fast;
+  logic [NUM_FORMATS-1:0][WIDTH-1:0]    fmt_fast_result;
+  fpnew_pkg::status_t [NUM_FORMATS-1:0] fmt_fast_status;
+
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_fast_path
+    // Set up some constants
+    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned BIAS     = fpnew_pkg::bias(fpnew_pkg::fp_format_e'(fmt));
+    // Reduced-precision results need rounding, which the fast path does not do
+    localparam bit REDUCED = (ReducedPrecision[fmt] != 0) && (ReducedPrecision[fmt] <= MAN_BITS);
+
+    typedef struct packed {
+      logic                sign;
+      logic [EXP_BITS-1:0] exponent;
+      logic [MAN_BITS-1:0] mantissa;
+    } fp_t;
+
+    if (FpFmtConfig[fmt]) begin : active_format
+      logic [1:0][FP_WIDTH-1:0]   trimmed_ops;
+      fpnew_pkg::fp_info_t [1:0]  info;
+      fp_t                        operand_a, operand_b, fast_result;
+      logic signed [EXP_BITS+1:0] quotient_exponent;
+
+      assign trimmed_ops[0] = operands_q[0][FP_WIDTH-1:0];
+      assign trimmed_ops[1] = operands_q[1][FP_WIDTH-1:0];
+      assign operand_a      = trimmed_ops[0];
+      assign operand_b      = trimmed_ops[1];
+
+      // Classify input
+      fpnew_classifier #(
+        .FpFormat    ( fpnew_pkg::fp_format_e'(fmt) ),
+        .NumOperands ( 2                            )
+      ) i_fpnew_classifier (
+        .operands_i ( trimmed_ops     ),
+        .is_boxed_i ( is_boxed_q[fmt] ),
+        .info_o     ( info            )
+      );
+
+      // Biased exponent of the quotient, exact if the divisor is a power of two
+      assign quotient_exponent = signed'({2'b0, operand_a.exponent})
+                                 - signed'({2'b0, operand_b.exponent}) + signed'(BIAS);
+
+      always_comb begin : fast_cases
+        // Default assignments
+        fmt_fast[fmt]        = 1'b1;
+        fast_result          = '{sign: 1'b0, exponent: '1, mantissa: 2**(MAN_BITS-1)}; // qNaN
+        fmt_fast_status[fmt] = '0;
+
+        // Invalid operations run a square root
+        if (op_q != fpnew_pkg::DIV) begin
+          // NaN input causes canonical quiet NaN at the output and maybe invalid OP
+          if (info[0].is_nan) begin
+            fmt_fast_status[fmt].NV = info[0].is_signalling;
+          // Square root of zero is zero of the same sign
+          end else if (info[0].is_zero) begin
+            fast_result = '{sign: operand_a.sign, exponent: '0, mantissa: '0};
+          // Square root of a negative number (including -inf) is invalid
+          end else if (operand_a.sign) begin
+            fmt_fast_status[fmt].NV = 1'b1;
+          // Square root of +inf is +inf
+          end else if (info[0].is_inf) begin
+            fast_result = '{sign: 1'b0, exponent: '1, mantissa: '0};
+          end else begin
+            fmt_fast[fmt] = 1'b0;
+          end
+        end else begin
+          // NaN inputs cause canonical quiet NaN at the output and maybe invalid OP
+          if (info[0].is_nan || info[1].is_nan) begin
+            fmt_fast_status[fmt].NV = info[0].is_signalling | info[1].is_signalling;
+          // inf / inf and 0 / 0 are invalid
+          end else if ((info[0].is_inf  && info[1].is_inf) ||
+                       (info[0].is_zero && info[1].is_zero)) begin
+            fmt_fast_status[fmt].NV = 1'b1;
+          // inf / x is inf, x / 0 is inf and raises division by zero for finite x
+          end else if (info[0].is_inf || info[1].is_zero) begin
+            fast_result = '{sign: operand_a.sign ^ operand_b.sign, exponent: '1, mantissa: '0};
+            fmt_fast_status[fmt].DZ = info[1].is_zero & ~info[0].is_inf;
+          // 0 / x and x / inf are zero
+          end else if (info[0].is_zero || info[1].is_inf) begin
+            fast_result = '{sign: operand_a.sign ^ operand_b.sign, exponent: '0, mantissa: '0};
+          // Dividing by a power of two only changes the exponent unless the result is not normal
+          end else if (info[0].is_normal && info[1].is_normal && operand_b.mantissa == '0 &&
+                       !(REDUCED && op_mod_q) && quotient_exponent >= 1 &&
+                       quotient_exponent <= signed'(2**EXP_BITS - 2)) begin
+            fast_result = '{sign:     operand_a.sign ^ operand_b.sign,
+                            exponent: quotient_exponent[EXP_BITS-1:0],
+                            mantissa: operand_a.mantissa};
+          end else begin
+            fmt_fast[fmt] = 1'b0;
+          end
+        end
+
+        // Initialize the result with ones (NaN-box)
+        fmt_fast_result[fmt]               = '1;
+        fmt_fast_result[fmt][FP_WIDTH-1:0] = fast_result;
+      end
+    end else begin : inactive_format
+      assign fmt_fast[fmt]        = 1'b0;
+      assign fmt_fast_result[fmt] = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_fast_status[fmt] = '{default: fpnew_pkg::DONT_CARE};
+    end
+  end
+
+  // Lanes that do not take part in the operation do not hold back the others
+  assign fast_path_o = fmt_fast[dst_fmt_q] | ~in_valid_q | ~FpFmtConfig[dst_fmt_q];
+
+  logic               fast_take, fast_ready;   // fast path handshake
+  logic               fast_valid_q, fast_out_ready;
+  logic [WIDTH-1:0]   fast_result_q;
+  fpnew_pkg::status_t fast_status_q;
+  TagType             fast_tag_q;
+  AuxType             fast_aux_q;
+
+  // The fast path register accepts a new result when it is empty or being emptied
+  assign fast_ready = ~fast_valid_q | fast_out_ready;
+  assign fast_take  = in_valid_q & fast_path_i & fast_ready & ~flush_i;
+
+  `FFLARNC(fast_valid_q, fast_take, fast_ready, flush_i, 1'b0, clk_i, rst_ni)
+  `FFL(fast_result_q, fmt_fast_result[dst_fmt_q],   fast_take, '0)
+  `FFL(fast_status_q, fmt_fast_status[dst_fmt_q],   fast_take, '0)
+  `FFL(fast_tag_q,    inp_pipe_tag_q[NUM_INP_REGS], fast_take, TagType'('0))
+  `FFL(fast_aux_q,    inp_pipe_aux_q[NUM_INP_REGS], fast_take, AuxType'('0))
+
+  // ------------------
+  // Unit Distribution
+  // ------------------
+  // Operations are distributed to the replicated units in round-robin fashion and their results
+  // are retired in the same order. Each unit accepts a new operation when its previous result is
+  // retired, so up to NumUnits operations are in flight.
+  localparam int unsigned UNIT_IDX_WIDTH = (NumUnits > 1) ? $clog2(NumUnits) : 1;
+
   logic in_ready;               // input handshake with upstream
-  logic div_valid, sqrt_valid;  // input signalling with unit
-  logic unit_ready, unit_done;  // status signals from unit instance
-  logic op_starting;            // high in the cycle a new operation starts
   logic out_valid, out_ready;   // output handshake with downstream
-  logic hold_result;            // whether to put result into hold register
-  logic data_is_held;           // data in hold register is valid
-  logic unit_busy;              // valid data in flight
-  // FSM states
-  typedef enum logic [1:0] {IDLE, BUSY, HOLD} fsm_state_e;
-  fsm_state_e state_q, state_d;
-
-  // Upstream ready comes from sanitization FSM
+  logic unit_out_ready;         // output handshake of the units
+
+  logic [UNIT_IDX_WIDTH-1:0] issue_unit_q, issue_unit_d;   // unit to receive the next operation
+  logic [UNIT_IDX_WIDTH-1:0] retire_unit_q, retire_unit_d; // unit holding the oldest operation
+
+  logic [NumUnits-1:0] unit_in_ready, unit_starting, unit_out_valid, unit_busy;
+
+  // Per-unit results
+  logic               [NumUnits-1:0][WIDTH-1:0] unit_results;
+  fpnew_pkg::status_t [NumUnits-1:0]            unit_statuses;
+  TagType             [NumUnits-1:0]            unit_tags;
+  AuxType             [NumUnits-1:0]            unit_auxs;
+
+  // Upstream ready comes from the fast path or the unit next in line
+  assign in_ready                     = fast_path_i ? fast_ready : unit_in_ready[issue_unit_q];
   assign inp_pipe_ready[NUM_INP_REGS] = in_ready;
 
-  // Valids are gated by the FSM ready. Invalid input ops run a sqrt to not lose illegal instr.
-  assign div_valid   = in_valid_q & (op_q == fpnew_pkg::DIV) & in_ready & ~flush_i;
-  assign sqrt_valid  = in_valid_q & (op_q != fpnew_pkg::DIV) & in_ready & ~flush_i;
-  assign op_starting = div_valid | sqrt_valid;
-
-  // FSM to safely apply and receive data from DIVSQRT unit
-  always_comb begin : flag_fsm
-    // Default assignments
-    in_ready     = 1'b0;
-    out_valid    = 1'b0;
-    hold_result  = 1'b0;
-    data_is_held = 1'b0;
-    unit_busy    = 1'b0;
-    state_d      = state_q;
-
-    unique case (state_q)
-      // Waiting for work
-      IDLE: begin
-        in_ready = 1'b1; // we're ready
-        if (in_valid_q && unit_ready) begin // New work arrives
-          state_d = BUSY; // go into processing state
+  // Downstream valid comes from the fast path first, then from the unit with the oldest operation
+  assign out_valid      = fast_valid_q | unit_out_valid[retire_unit_q];
+  assign fast_out_ready = out_ready;
+  assign unit_out_ready = out_ready & ~fast_valid_q;
+
+  // Advance the unit pointers on handshakes, flush returns to the first unit
+  always_comb begin : update_unit_pointers
+    issue_unit_d  = issue_unit_q;
+    retire_unit_d = retire_unit_q;
+    if (| unit_starting)
+      issue_unit_d = (issue_unit_q == NumUnits-1) ? '0 : issue_unit_q + 1;
+    if (unit_out_valid[retire_unit_q] && unit_out_ready)
+      retire_unit_d = (retire_unit_q == NumUnits-1) ? '0 : retire_unit_q + 1;
+    if (flush_i) begin
+      issue_unit_d  = '0;
+      retire_unit_d = '0;
+    end
+  end
+
+  `FF(issue_unit_q, issue_unit_d, '0)
+  `FF(retire_unit_q, retire_unit_d, '0)
+
+  for (genvar unit = 0; unit < int'(NumUnits); unit++) begin : gen_units
+    // ------------
+    // Control FSM
+    // ------------
+    logic unit_in_valid, local_in_ready;    // input handshake with upstream
+    logic div_valid, sqrt_valid;            // input signalling with unit
+    logic unit_ready, unit_done;            // status signals from unit instance
+    logic op_starting;                      // high in the cycle a new operation starts
+    logic local_out_valid, local_out_ready; // output handshake with downstream
+    logic hold_result;                      // whether to put result into hold register
+    logic data_is_held;                     // data in hold register is valid
+    logic local_busy;                       // valid data in flight
+    // FSM states
+    typedef enum logic [1:0] {IDLE, BUSY, HOLD} fsm_state_e;
+    fsm_state_e state_q, state_d;
+
+    // Operations are offered to the unit next in line, results are taken from the oldest unit
+    assign unit_in_valid   = in_valid_q & ~fast_path_i & (issue_unit_q == unit);
+    assign local_out_ready = unit_out_ready & (retire_unit_q == unit);
+
+    // Valids are gated by the FSM ready. Invalid input ops run a sqrt to not lose illegal instr.
+    assign div_valid   = unit_in_valid & (op_q == fpnew_pkg::DIV) & local_in_ready & ~flush_i;
+    assign sqrt_valid  = unit_in_valid & (op_q != fpnew_pkg::DIV) & local_in_ready & ~flush_i;
+    assign op_starting = div_valid | sqrt_valid;
+
+    // FSM to safely apply and receive data from DIVSQRT unit
+    always_comb begin : flag_fsm
+      // Default assignments
+      local_in_ready  = 1'b0;
+      local_out_valid = 1'b0;
+      hold_result     = 1'b0;
+      data_is_held    = 1'b0;
+      local_busy      = 1'b0;
+      state_d         = state_q;
+
+      unique case (state_q)
+        // Waiting for work
+        IDLE: begin
+          local_in_ready = 1'b1; // we're ready
+          if (unit_in_valid && unit_ready) begin // New work arrives
+            state_d = BUSY; // go into processing state
+          end
         end
-      end
-      // Operation in progress
-      BUSY: begin
-        unit_busy = 1'b1; // data in flight
-        // If the unit is done with processing
-        if (unit_done) begin
-          out_valid = 1'b1; // try to commit result downstream
-          // If downstream accepts our result
-          if (out_ready) begin
-            state_d = IDLE; // we anticipate going back to idling..
-            if (in_valid_q && unit_ready) begin // ..unless new work comes in
-              in_ready = 1'b1; // we acknowledge the instruction
-              state_d  = BUSY; // and stay busy with it
+        // Operation in progress
+        BUSY: begin
+          local_busy = 1'b1; // data in flight
+          // If the unit is done with processing
+          if (unit_done) begin
+            local_out_valid = 1'b1; // try to commit result downstream
+            // If downstream accepts our result
+            if (local_out_ready) begin
+              state_d = IDLE; // we anticipate going back to idling..
+              if (unit_in_valid && unit_ready) begin // ..unless new work comes in
+                local_in_ready = 1'b1; // we acknowledge the instruction
+                state_d        = BUSY; // and stay busy with it
+              end
+            // Otherwise if downstream is not ready for the result
+            end else begin
+              hold_result = 1'b1; // activate the hold register
+              state_d     = HOLD; // wait for the pipeline to take the data
             end
-          // Otherwise if downstream is not ready for the result
-          end else begin
-            hold_result = 1'b1; // activate the hold register
-            state_d     = HOLD; // wait for the pipeline to take the data
           end
         end
-      end
-      // Waiting with valid result for downstream
-      HOLD: begin
-        unit_busy    = 1'b1; // data in flight
-        data_is_held = 1'b1; // data in hold register is valid
-        out_valid    = 1'b1; // try to commit result downstream
-        // If the result is accepted by downstream
-        if (out_ready) begin
-          state_d = IDLE; // go back to idle..
-          if (in_valid_q && unit_ready) begin // ..unless new work comes in
-            in_ready = 1'b1; // acknowledge the new transaction
-            state_d  = BUSY; // will be busy with the next instruction
+        // Waiting with valid result for downstream
+        HOLD: begin
+          local_busy      = 1'b1; // data in flight
+          data_is_held    = 1'b1; // data in hold register is valid
+          local_out_valid = 1'b1; // try to commit result downstream
+          // If the result is accepted by downstream
+          if (local_out_ready) begin
+            state_d = IDLE; // go back to idle..
+            if (unit_in_valid && unit_ready) begin // ..unless new work comes in
+              local_in_ready = 1'b1; // acknowledge the new transaction
+              state_d        = BUSY; // will be busy with the next instruction
+            end
           end
         end
-      end
-      // fall into idle state otherwise
-      default: state_d = IDLE;
-    endcase
+        // fall into idle state otherwise
+        default: state_d = IDLE;
+      endcase
 
-    // Flushing overrides the other actions
-    if (flush_i) begin
-      unit_busy = 1'b0; // data is invalidated
-      out_valid = 1'b0; // cancel any valid data
-      state_d   = IDLE; // go to default state
+      // Flushing overrides the other actions
+      if (flush_i) begin
+        local_busy      = 1'b0; // data is invalidated
+        local_out_valid = 1'b0; // cancel any valid data
+        state_d         = IDLE; // go to default state
+      end
     end
-  end
 
-  // FSM status register (asynch active low reset)
-  `FF(state_q, state_d, IDLE)
+    // FSM status register (asynch active low reset)
+    `FF(state_q, state_d, IDLE)
 
-  // Hold additional information while the operation is in progress
-  logic result_is_fp8_q;
-  TagType result_tag_q;
-  AuxType result_aux_q;
+    assign unit_in_ready[unit]  = local_in_ready;
+    assign unit_starting[unit]  = op_starting;
+    assign unit_out_valid[unit] = local_out_valid;
+    assign unit_busy[unit]      = local_busy;
 
-  // Fill the registers everytime a valid operation arrives (load FF, active low asynch rst)
-  `FFL(result_is_fp8_q, input_is_fp8,                 op_starting, '0)
-  `FFL(result_tag_q,    inp_pipe_tag_q[NUM_INP_REGS], op_starting, '0)
-  `FFL(result_aux_q,    inp_pipe_aux_q[NUM_INP_REGS], op_starting, '0)
+    // Hold additional information while the operation is in progress
+    logic result_is_fp8_q;
 
-  // -----------------
-  // DIVSQRT instance
-  // -----------------
-  logic [63:0]        unit_result;
-  logic [WIDTH-1:0]   adjusted_result, held_result_q;
-  fpnew_pkg::status_t unit_status, held_status_q;
-
-  div_sqrt_top_mvp i_divsqrt_lei (
-   .Clk_CI           ( clk_i               ),
-   .Rst_RBI          ( rst_ni              ),
-   .Div_start_SI     ( div_valid           ),
-   .Sqrt_start_SI    ( sqrt_valid          ),
-   .Operand_a_DI     ( divsqrt_operands[0] ),
-   .Operand_b_DI     ( divsqrt_operands[1] ),
-   .RM_SI            ( rnd_mode_q          ),
-   .Precision_ctl_SI ( '0                  ),
-   .Format_sel_SI    ( divsqrt_fmt         ),
-   .Kill_SI          ( flush_i             ),
-   .Result_DO        ( unit_result         ),
-   .Fflags_SO        ( unit_status         ),
-   .Ready_SO         ( unit_ready          ),
-   .Done_SO          ( unit_done           )
-  );
-
-  // Adjust result width and fix FP8
-  assign adjusted_result = result_is_fp8_q ? unit_result >> 8 : unit_result;
-
-  // The Hold register (load, no reset)
-  `FFLNR(held_result_q, adjusted_result, hold_result, clk_i)
-  `FFLNR(held_status_q, unit_status,     hold_result, clk_i)
+    // Fill the registers everytime a valid operation arrives (load FF, active low asynch rst)
+    `FFL(result_is_fp8_q, input_is_fp8,                 op_starting, '0)
+    `FFL(unit_tags[unit], inp_pipe_tag_q[NUM_INP_REGS], op_starting, '0)
+    `FFL(unit_auxs[unit], inp_pipe_aux_q[NUM_INP_REGS], op_starting, '0)
+
+    // -----------------
+    // DIVSQRT instance
+    // -----------------
+    logic [WIDTH-1:0]   adjusted_result, held_result_q;
+    fpnew_pkg::status_t unit_status, held_status_q;
+
+    if (DivSqrtConfig == fpnew_pkg::PULP_DIVSQRT) begin : gen_pulp_divsqrt
+      logic [63:0]           unit_result;
+      logic [WIDTH-1:0]      truncated_result;
+      fpnew_pkg::roundmode_e unit_rnd_mode;
+      logic                  result_is_rod_q, result_inexact;
+
+      // The unit only knows the RISC-V rounding modes, RSR rounds toward zero like in the in-tree
+      // units, which have no random number generator either. ROD is emulated by rounding toward
+      // zero and setting the LSB of inexact results.
+      assign unit_rnd_mode = (rnd_mode_q inside {fpnew_pkg::RSR, fpnew_pkg::ROD})
+                             ? fpnew_pkg::RTZ
+                             : rnd_mode_q;
+
+      `FFL(result_is_rod_q, (rnd_mode_q == fpnew_pkg::ROD), op_starting, '0)
+
+      div_sqrt_top_mvp i_divsqrt_lei (
+       .Clk_CI           ( clk_i               ),
+       .Rst_RBI          ( rst_ni              ),
+       .Div_start_SI     ( div_valid           ),
+       .Sqrt_start_SI    ( sqrt_valid          ),
+       .Operand_a_DI     ( divsqrt_operands[0] ),
+       .Operand_b_DI     ( divsqrt_operands[1] ),
+       .RM_SI            ( unit_rnd_mode       ),
+       .Precision_ctl_SI ( divsqrt_precision   ),
+       .Format_sel_SI    ( divsqrt_fmt         ),
+       .Kill_SI          ( flush_i             ),
+       .Result_DO        ( unit_result         ),
+       .Fflags_SO        ( unit_status         ),
+       .Ready_SO         ( unit_ready          ),
+       .Done_SO          ( unit_done           )
+      );
+
+      // Adjust result width and fix FP8. FP8 results are also inexact if a truncated bit is set.
+      assign truncated_result = result_is_fp8_q ? unit_result >> 8 : unit_result;
+      assign result_inexact   = unit_status.NX | (result_is_fp8_q & (| unit_result[7:0]));
+      assign adjusted_result  = truncated_result | WIDTH'(result_is_rod_q & result_inexact);
+
+    // In-tree digit recurrence, computes StepsPerCycle result bits per cycle
+    end else begin : gen_recurrence
+      fpnew_divsqrt_recurrence #(
+        .FpFmtConfig      ( FpFmtConfig                                      ),
+        .StepsPerCycle    ( (DivSqrtConfig == fpnew_pkg::RADIX2_X2) ? 2 : 1 ),
+        .ReducedPrecision ( ReducedPrecision                                 )
+      ) i_divsqrt_recurrence (
+        .clk_i,
+        .rst_ni,
+        .operands_i     ( operands_q      ),
+        .is_boxed_i     ( is_boxed_q      ),
+        .rnd_mode_i     ( rnd_mode_q      ),
+        .op_i           ( op_q            ),
+        .dst_fmt_i      ( dst_fmt_q       ),
+        .reduced_prec_i ( op_mod_q        ),
+        .start_i        ( op_starting     ),
+        .kill_i         ( flush_i         ),
+        .done_o         ( unit_done       ),
+        .result_o       ( adjusted_result ),
+        .status_o       ( unit_status     )
+      );
+
+      assign unit_ready = 1'b1; // the recurrence can be restarted at any time
+    end
+
+    // The Hold register (load, no reset)
+    `FFLNR(held_result_q, adjusted_result, hold_result, clk_i)
+    `FFLNR(held_status_q, unit_status,     hold_result, clk_i)
+
+    // Prioritize hold register data
+    assign unit_results[unit]  = data_is_held ? held_result_q : adjusted_result;
+    assign unit_statuses[unit] = data_is_held ? held_status_q : unit_status;
+  end
 
   // --------------
   // Output Select
   // --------------
   logic [WIDTH-1:0]   result_d;
   fpnew_pkg::status_t status_d;
-  // Prioritize hold register data
-  assign result_d = data_is_held ? held_result_q : adjusted_result;
-  assign status_d = data_is_held ? held_status_q : unit_status;
+  TagType             result_tag;
+  AuxType             result_aux;
+  // Fast path results leave first, then the oldest operation in the units
+  assign result_d   = fast_valid_q ? fast_result_q : unit_results[retire_unit_q];
+  assign status_d   = fast_valid_q ? fast_status_q : unit_statuses[retire_unit_q];
+  assign result_tag = fast_valid_q ? fast_tag_q    : unit_tags[retire_unit_q];
+  assign result_aux = fast_valid_q ? fast_aux_q    : unit_auxs[retire_unit_q];
 
   // ----------------
   // Output Pipeline
@@ -306,8 +566,8 @@ module fpnew_divsqrt_multi #(
   // Input stage: First element of pipeline is taken from inputs
   assign out_pipe_result_q[0] = result_d;
   assign out_pipe_status_q[0] = status_d;
-  assign out_pipe_tag_q[0]    = result_tag_q;
-  assign out_pipe_aux_q[0]    = result_aux_q;
+  assign out_pipe_tag_q[0]    = result_tag;
+  assign out_pipe_aux_q[0]    = result_aux;
   assign out_pipe_valid_q[0]  = out_valid;
   // Input stage: Propagate pipeline ready signal to inside pipe
   assign out_ready = out_pipe_ready[0];
@@ -338,5 +598,5 @@ module fpnew_divsqrt_multi #(
   assign tag_o           = out_pipe_tag_q[NUM_OUT_REGS];
   assign aux_o           = out_pipe_aux_q[NUM_OUT_REGS];
   assign out_valid_o     = out_pipe_valid_q[NUM_OUT_REGS];
-  assign busy_o          = (| {inp_pipe_valid_q, unit_busy, out_pipe_valid_q});
+  assign busy_o          = (| {inp_pipe_valid_q, fast_valid_q, unit_busy, out_pipe_valid_q});
 endmodule
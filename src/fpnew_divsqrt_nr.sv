@@ -0,0 +1,824 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License. You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+//
+// SPDX-License-Identifier: SHL-0.51
+
+// Author: agent <agent@local>
+
+`include "common_cells/registers.svh"
+
+// Scalar division and square root by Newton-Raphson iterations on the FMA units of the ADDMUL
+// operation group. The iterations start from the reciprocal (square root) estimate tables and
+// every step issues a single FMA operation, so the FMA units accept other operations in between.
+// The result is computed rounded towards zero and its correctly rounded value is determined from
+// the signs of two remainders.
+module fpnew_divsqrt_nr #(
+  parameter fpnew_pkg::fmt_logic_t FpFmtConfig = '1,
+  parameter int unsigned           Width       = 32,
+  parameter type                   TagType     = logic,
+  // Do not change
+  localparam int unsigned NUM_FORMATS = fpnew_pkg::NUM_FP_FORMATS
+) (
+  input  logic                        clk_i,
+  input  logic                        rst_ni,
+  // Input signals
+  input  logic [1:0][Width-1:0]       operands_i, // 2 operands
+  input  logic [NUM_FORMATS-1:0][1:0] is_boxed_i, // 2 operands
+  input  fpnew_pkg::roundmode_e       rnd_mode_i,
+  input  fpnew_pkg::operation_e       op_i,
+  input  fpnew_pkg::fp_format_e       dst_fmt_i,
+  input  TagType                      tag_i,
+  // Input Handshake
+  input  logic                        in_valid_i,
+  output logic                        in_ready_o,
+  input  logic                        flush_i,
+  // Output signals
+  output logic [Width-1:0]            result_o,
+  output fpnew_pkg::status_t          status_o,
+  output logic                        extension_bit_o,
+  output TagType                      tag_o,
+  // Output handshake
+  output logic                        out_valid_o,
+  input  logic                        out_ready_i,
+  // Indication of valid data in flight
+  output logic                        busy_o,
+  // FMA operations issued to the ADDMUL operation group, scalar in the destination format
+  output logic [2:0][Width-1:0]       fma_operands_o,
+  output fpnew_pkg::roundmode_e       fma_rnd_mode_o,
+  output fpnew_pkg::operation_e       fma_op_o,
+  output fpnew_pkg::fp_format_e       fma_fmt_o,
+  output logic                        fma_in_valid_o,
+  input  logic                        fma_in_ready_i,
+  // FMA results
+  input  logic [Width-1:0]            fma_result_i,
+  input  logic                        fma_out_valid_i,
+  output logic                        fma_out_ready_o
+);
+
+  // ----------
+  // Constants
+  // ----------
+  // The super-format that can hold all formats
+  localparam fpnew_pkg::fp_encoding_t SUPER_FORMAT = fpnew_pkg::super_format(FpFmtConfig);
+
+  localparam int unsigned SUPER_EXP_BITS = SUPER_FORMAT.exp_bits;
+  localparam int unsigned SUPER_MAN_BITS = SUPER_FORMAT.man_bits;
+
+  // Precision bits 'p' include the implicit bit
+  localparam int unsigned PRECISION_BITS = SUPER_MAN_BITS + 1;
+
+  // Newton-Raphson iterations per format. The precision of the estimate at least doubles in every
+  // iteration, the final step corrects the remaining error of the last one.
+  function automatic fpnew_pkg::fmt_unsigned_t get_iterations();
+    automatic fpnew_pkg::fmt_unsigned_t res;
+    for (int unsigned fmt = 0; fmt < NUM_FORMATS; fmt++) begin
+      automatic int unsigned precision = fpnew_pkg::est_bits(fpnew_pkg::fp_format_e'(fmt));
+      res[fmt] = 1;
+      while (precision < fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt))) begin
+        precision = 2 * precision;
+        res[fmt]++;
+      end
+    end
+    return res;
+  endfunction
+
+  localparam fpnew_pkg::fmt_unsigned_t ITERATIONS = get_iterations();
+
+  // There are never more iterations than mantissa bits
+  localparam int unsigned ITER_WIDTH = $clog2(SUPER_MAN_BITS + 1);
+  // Internal exponents need to hold the difference of biased exponents
+  localparam int unsigned EXP_WIDTH = SUPER_EXP_BITS + 2;
+  localparam int unsigned LZC_RESULT_WIDTH = $clog2(PRECISION_BITS);
+
+  // -----------------
+  // Input processing
+  // -----------------
+  logic [NUM_FORMATS-1:0][1:0]                     fmt_sign;
+  logic [NUM_FORMATS-1:0][1:0][EXP_WIDTH-1:0]      fmt_exponent;
+  logic [NUM_FORMATS-1:0][1:0][PRECISION_BITS-1:0] fmt_mantissa; // left-aligned
+
+  fpnew_pkg::fp_info_t [NUM_FORMATS-1:0][1:0] fmt_info;
+
+  // FP Input initialization
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : fmt_init_inputs
+    // Set up some constants
+    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+
+    if (FpFmtConfig[fmt]) begin : active_format
+      logic [1:0][FP_WIDTH-1:0] trimmed_ops;
+
+      // Classify input
+      fpnew_classifier #(
+        .FpFormat    ( fpnew_pkg::fp_format_e'(fmt) ),
+        .NumOperands ( 2                            )
+      ) i_fpnew_classifier (
+        .operands_i ( trimmed_ops     ),
+        .is_boxed_i ( is_boxed_i[fmt] ),
+        .info_o     ( fmt_info[fmt]   )
+      );
+      for (genvar op = 0; op < 2; op++) begin : gen_operands
+        assign trimmed_ops[op]       = operands_i[op][FP_WIDTH-1:0];
+        assign fmt_sign[fmt][op]     = operands_i[op][FP_WIDTH-1];
+        // Real exponents are (ex = Ex - bias + 1 - nx), internal exponents stay biased
+        assign fmt_exponent[fmt][op] = operands_i[op][MAN_BITS+:EXP_BITS]
+                                       + fmt_info[fmt][op].is_subnormal;
+        assign fmt_mantissa[fmt][op] = {fmt_info[fmt][op].is_normal, operands_i[op][MAN_BITS-1:0]}
+                                       << (SUPER_MAN_BITS - MAN_BITS); // move to left of mantissa
+      end
+    end else begin : inactive_format
+      assign fmt_info[fmt]     = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_sign[fmt]     = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_exponent[fmt] = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_mantissa[fmt] = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+    end
+  end
+
+  fpnew_pkg::fp_info_t info_a, info_b;
+  logic                sign_a, sign_b;
+  logic                is_sqrt; // invalid operations run a square root
+
+  // Operation selection: DIV computes a / b, SQRT computes sqrt(a)
+  assign info_a  = fmt_info[dst_fmt_i][0];
+  assign info_b  = fmt_info[dst_fmt_i][1];
+  assign sign_a  = fmt_sign[dst_fmt_i][0];
+  assign sign_b  = fmt_sign[dst_fmt_i][1];
+  assign is_sqrt = (op_i != fpnew_pkg::DIV);
+
+  // ----------------------
+  // Special case handling
+  // ----------------------
+  logic [Width-1:0]   special_result;
+  fpnew_pkg::status_t special_status;
+  logic               result_is_special;
+
+  logic [NUM_FORMATS-1:0][Width-1:0] fmt_special_result;
+
+  typedef enum logic [1:0] {QNAN, INF, ZERO} special_value_e;
+  special_value_e special_value;
+  logic           special_sign;
+
+  always_comb begin : special_cases
+    // Default assignments
+    special_value     = QNAN; // canonical qNaN
+    special_sign      = 1'b0;
+    special_status    = '0;
+    result_is_special = 1'b0;
+
+    if (is_sqrt) begin
+      // NaN input causes canonical quiet NaN at the output and maybe invalid OP
+      if (info_a.is_nan) begin
+        result_is_special = 1'b1;
+        special_status.NV = info_a.is_signalling;
+      // Square root of zero is zero of the same sign
+      end else if (info_a.is_zero) begin
+        result_is_special = 1'b1;
+        special_value     = ZERO;
+        special_sign      = sign_a;
+      // Square root of a negative number (including -inf) is invalid
+      end else if (sign_a) begin
+        result_is_special = 1'b1;
+        special_status.NV = 1'b1;
+      // Square root of +inf is +inf
+      end else if (info_a.is_inf) begin
+        result_is_special = 1'b1;
+        special_value     = INF;
+      end
+    end else begin
+      // NaN inputs cause canonical quiet NaN at the output and maybe invalid OP
+      if (info_a.is_nan || info_b.is_nan) begin
+        result_is_special = 1'b1;
+        special_status.NV = info_a.is_signalling | info_b.is_signalling;
+      // inf / inf and 0 / 0 are invalid
+      end else if ((info_a.is_inf && info_b.is_inf) || (info_a.is_zero && info_b.is_zero)) begin
+        result_is_special = 1'b1;
+        special_status.NV = 1'b1;
+      // inf / x is inf, x / 0 is inf and raises division by zero for finite x
+      end else if (info_a.is_inf || info_b.is_zero) begin
+        result_is_special = 1'b1;
+        special_value     = INF;
+        special_sign      = sign_a ^ sign_b;
+        special_status.DZ = info_b.is_zero & ~info_a.is_inf;
+      // 0 / x and x / inf are zero
+      end else if (info_a.is_zero || info_b.is_inf) begin
+        result_is_special = 1'b1;
+        special_value     = ZERO;
+        special_sign      = sign_a ^ sign_b;
+      end
+    end
+  end
+
+  // Encode the special result in every format
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_special_results
+    // Set up some constants
+    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+
+    localparam logic [EXP_BITS-1:0] QNAN_EXPONENT = '1;
+    localparam logic [MAN_BITS-1:0] QNAN_MANTISSA = 2**(MAN_BITS-1);
+    localparam logic [MAN_BITS-1:0] ZERO_MANTISSA = '0;
+
+    if (FpFmtConfig[fmt]) begin : active_format
+      logic [FP_WIDTH-1:0] special_res;
+
+      always_comb begin : special_results
+        unique case (special_value)
+          INF:     special_res = {special_sign, QNAN_EXPONENT, ZERO_MANTISSA};
+          ZERO:    special_res = {special_sign, {EXP_BITS{1'b0}}, ZERO_MANTISSA};
+          default: special_res = {1'b0, QNAN_EXPONENT, QNAN_MANTISSA}; // qNaN
+        endcase
+        // Initialize special result with ones (NaN-box)
+        fmt_special_result[fmt]               = '1;
+        fmt_special_result[fmt][FP_WIDTH-1:0] = special_res;
+      end
+    end else begin : inactive_format
+      assign fmt_special_result[fmt] = '{default: fpnew_pkg::DONT_CARE};
+    end
+  end
+
+  assign special_result = fmt_special_result[dst_fmt_i];
+
+  // ----------------------
+  // Operand normalization
+  // ----------------------
+  logic [1:0][PRECISION_BITS-1:0] norm_mantissa; // mantissae in [1, 2)
+  logic [1:0][EXP_WIDTH-1:0]      norm_exponent; // signed biased exponents of the mantissae
+
+  // Subnormal operands are normalized by shifting out their leading zeroes
+  for (genvar op = 0; op < 2; op++) begin : gen_normalize
+    logic [PRECISION_BITS-1:0]   mantissa;
+    logic [LZC_RESULT_WIDTH-1:0] leading_zeros;
+    logic                        lzc_zeroes; // mantissa is zero, only for zero operands
+
+    assign mantissa = fmt_mantissa[dst_fmt_i][op];
+
+    lzc #(
+      .WIDTH ( PRECISION_BITS ),
+      .MODE  ( 1              ) // MODE = 1 counts leading zeroes
+    ) i_lzc (
+      .in_i    ( mantissa      ),
+      .cnt_o   ( leading_zeros ),
+      .empty_o ( lzc_zeroes    )
+    );
+
+    assign norm_mantissa[op] = mantissa << leading_zeros;
+    assign norm_exponent[op] = signed'(fmt_exponent[dst_fmt_i][op])
+                               - signed'({1'b0, leading_zeros});
+  end
+
+  // ----------------
+  // Iteration setup
+  // ----------------
+  logic                        exponent_a_odd; // radicand is adjusted for even exponent
+  logic                        sign_d;
+  logic signed [EXP_WIDTH-1:0] exp_offset_d;   // added to the exponent of the scaled result
+  logic                        b_all_ones;     // divisor mantissa is all ones
+
+  // Operands scaled to [1, 2) ([1, 4) for SQRT) and the seed per format
+  logic [NUM_FORMATS-1:0][Width-1:0] fmt_operand_a, fmt_operand_b, fmt_seed;
+  logic [NUM_FORMATS-1:0]            fmt_b_all_ones;
+
+  // All biases are odd, so the unbiased exponent is odd for even biased exponents
+  assign exponent_a_odd = ~norm_exponent[0][0];
+
+  always_comb begin : setup_iterations
+    automatic int unsigned bias = fpnew_pkg::bias(dst_fmt_i);
+    if (is_sqrt) begin
+      // The radicand is brought into [1, 4) to make the exponent even, the root has half of it
+      sign_d       = sign_a;
+      exp_offset_d = (signed'(norm_exponent[0]) - signed'(bias)
+                      - signed'({1'b0, exponent_a_odd})) >>> 1;
+    end else begin
+      sign_d       = sign_a ^ sign_b;
+      exp_offset_d = signed'(norm_exponent[0]) - signed'(norm_exponent[1]);
+    end
+  end
+
+  assign b_all_ones = fmt_b_all_ones[dst_fmt_i] & ~is_sqrt;
+
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_setup
+    // Set up some constants
+    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned BIAS     = fpnew_pkg::bias(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EST_BITS = fpnew_pkg::est_bits(fpnew_pkg::fp_format_e'(fmt));
+
+    typedef struct packed {
+      logic                sign;
+      logic [EXP_BITS-1:0] exponent;
+      logic [MAN_BITS-1:0] mantissa;
+    } fp_t;
+
+    if (FpFmtConfig[fmt]) begin : active_format
+      logic [2**EST_BITS-1:0][EST_BITS-1:0] rece_table, rsqrte_table;
+      logic [1:0][MAN_BITS-1:0]             mantissa;
+      logic [EST_BITS-1:0]                  rece_index, rsqrte_index;
+      fp_t                                  operand_a, operand_b, seed;
+
+      // Same estimate tables as the RECE and RSQRTE operations
+      for (genvar i = 0; i < 2**EST_BITS; i++) begin : gen_tables
+        assign rece_table[i]   = EST_BITS'(fpnew_pkg::rece_entry(i, EST_BITS));
+        assign rsqrte_table[i] = EST_BITS'(fpnew_pkg::rsqrte_entry(i, EST_BITS));
+      end
+
+      // Mantissa bits below the implicit bit
+      assign mantissa[0] = norm_mantissa[0][PRECISION_BITS-2-:MAN_BITS];
+      assign mantissa[1] = norm_mantissa[1][PRECISION_BITS-2-:MAN_BITS];
+
+      // The reciprocal square root index MSB is the exponent LSB
+      assign rece_index   = mantissa[1][MAN_BITS-1-:EST_BITS];
+      assign rsqrte_index = {~exponent_a_odd, mantissa[0][MAN_BITS-1-:EST_BITS-1]};
+
+      always_comb begin : scale_operands
+        if (is_sqrt) begin
+          // Operand B holds 2a, the seed is halved: the iterations refine g = a/sqrt(a) and
+          // h = 1/(2*sqrt(a)) with the same FMA operation for both
+          operand_a = '{sign: 1'b0, exponent: BIAS + exponent_a_odd, mantissa: mantissa[0]};
+          operand_b = '{sign: 1'b0, exponent: BIAS + exponent_a_odd + 1, mantissa: mantissa[0]};
+          seed      = '{sign:     1'b0,
+                        exponent: BIAS - 2,
+                        mantissa: MAN_BITS'(rsqrte_table[rsqrte_index]) << (MAN_BITS - EST_BITS)};
+        end else begin
+          operand_a = '{sign: 1'b0, exponent: BIAS, mantissa: mantissa[0]};
+          operand_b = '{sign: 1'b0, exponent: BIAS, mantissa: mantissa[1]};
+          seed      = '{sign:     1'b0,
+                        exponent: BIAS - 1,
+                        mantissa: MAN_BITS'(rece_table[rece_index]) << (MAN_BITS - EST_BITS)};
+        end
+        // Initialize operands with ones (NaN-box)
+        fmt_operand_a[fmt]               = '1;
+        fmt_operand_a[fmt][FP_WIDTH-1:0] = operand_a;
+        fmt_operand_b[fmt]               = '1;
+        fmt_operand_b[fmt][FP_WIDTH-1:0] = operand_b;
+        fmt_seed[fmt]                    = '1;
+        fmt_seed[fmt][FP_WIDTH-1:0]      = seed;
+      end
+
+      assign fmt_b_all_ones[fmt] = (mantissa[1] == '1);
+    end else begin : inactive_format
+      assign fmt_operand_a[fmt]  = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_operand_b[fmt]  = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_seed[fmt]       = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_b_all_ones[fmt] = fpnew_pkg::DONT_CARE;
+    end
+  end
+
+  // --------
+  // Control
+  // --------
+  // Steps of the iterations, each one is a single FMA operation:
+  // - DIV:  y = 1/b refined n times by (REC_ERR, REC_UPD), then q = a * y is corrected once
+  // - SQRT: g = sqrt(a) and h = 1/(2*sqrt(a)) refined n times by (ROOT_ERR, ROOT_UPD, RSQRT_UPD)
+  // The final result f is rounded towards zero. Truncated to the target precision as c, the
+  // remainders of c and of the midpoint between c and its successor give round and sticky bits.
+  typedef enum logic [3:0] {
+    REC_ERR,   // r = 1 - b * y
+    REC_UPD,   // y = y + r * y
+    QUOT,      // q = a * y
+    QUOT_REM,  // r = a - b * q
+    QUOT_UPD,  // q = q + r * y
+    ROOT,      // g = 2a * h
+    ROOT_ERR,  // r = 1/2 - g * h
+    ROOT_UPD,  // g = g + g * r
+    RSQRT_UPD, // h = h + h * r
+    FINAL_REM, // r = a - b * q (DIV), r = a - g * g (SQRT)
+    FINAL,     // f = q + r * y (DIV), f = g + r * h (SQRT), rounded towards zero
+    REM_TRUNC, // r = a - b * c (DIV), r = a - c * c (SQRT)
+    REM_MID    // r = r - b * ulp/2 (DIV), r = r - c * ulp (SQRT)
+  } step_e;
+
+  typedef enum logic [1:0] {IDLE, ISSUE, WAIT, DONE} fsm_state_e;
+
+  fsm_state_e            state_q, state_d;
+  step_e                 step_q, step_d;
+  logic [ITER_WIDTH-1:0] iter_cnt_q, iter_cnt_d;
+  logic                  start, fma_done;
+
+  // Operations are accepted when idle, the FMA takes one step at a time
+  assign in_ready_o      = (state_q == IDLE);
+  assign start           = in_valid_i & in_ready_o;
+  assign fma_in_valid_o  = (state_q == ISSUE);
+  // FMA results may arrive in the same cycle as their operation is issued
+  assign fma_out_ready_o = (state_q == ISSUE) | (state_q == WAIT);
+  assign fma_done        = fma_out_valid_i & fma_out_ready_o;
+
+  always_comb begin : sequencer
+    // Default assignments
+    state_d    = state_q;
+    step_d     = step_q;
+    iter_cnt_d = iter_cnt_q;
+
+    unique case (state_q)
+      // Special cases need no iterations
+      IDLE: begin
+        if (in_valid_i) begin
+          state_d    = result_is_special ? DONE : ISSUE;
+          step_d     = is_sqrt ? ROOT : REC_ERR;
+          iter_cnt_d = ITER_WIDTH'(ITERATIONS[dst_fmt_i]);
+        end
+      end
+      ISSUE, WAIT: begin
+        if (state_q == ISSUE && fma_in_ready_i) state_d = WAIT;
+        // The result of an FMA operation starts the next step
+        if (fma_done) begin
+          state_d = ISSUE;
+          unique case (step_q)
+            REC_ERR: step_d = REC_UPD;
+            REC_UPD: begin
+              iter_cnt_d = iter_cnt_q - 1;
+              step_d     = (iter_cnt_q == 1) ? QUOT : REC_ERR;
+            end
+            QUOT:     step_d = QUOT_REM;
+            QUOT_REM: step_d = QUOT_UPD;
+            QUOT_UPD: step_d = FINAL_REM;
+            ROOT:     step_d = ROOT_ERR;
+            ROOT_ERR: step_d = ROOT_UPD;
+            ROOT_UPD: step_d = RSQRT_UPD;
+            RSQRT_UPD: begin
+              iter_cnt_d = iter_cnt_q - 1;
+              step_d     = (iter_cnt_q == 1) ? FINAL_REM : ROOT_ERR;
+            end
+            FINAL_REM: step_d  = FINAL;
+            FINAL:     step_d  = REM_TRUNC;
+            REM_TRUNC: step_d  = REM_MID;
+            default:   state_d = DONE; // REM_MID
+          endcase
+        end
+      end
+      DONE: if (out_ready_i) state_d = IDLE;
+      default: state_d = IDLE;
+    endcase
+
+    // Flushing aborts the operation, FMA results still in flight are dropped by the ADDMUL group
+    if (flush_i) state_d = IDLE;
+  end
+
+  `FF(state_q,    state_d,    IDLE)
+  `FF(step_q,     step_d,     REC_ERR)
+  `FF(iter_cnt_q, iter_cnt_d, '0)
+
+  // Hold information while the operation is in progress
+  logic                        is_sqrt_q;
+  logic                        sign_q;
+  logic signed [EXP_WIDTH-1:0] exp_offset_q;
+  logic                        b_all_ones_q;
+  fpnew_pkg::roundmode_e       rnd_mode_q;
+  fpnew_pkg::fp_format_e       dst_fmt_q;
+  TagType                      tag_q;
+  logic                        result_is_special_q;
+  logic [Width-1:0]            special_result_q;
+  fpnew_pkg::status_t          special_status_q;
+  logic [Width-1:0]            operand_a_q, operand_b_q;
+
+  // Fill the registers everytime a valid operation arrives (load FF, active low asynch rst)
+  `FFL(is_sqrt_q,           is_sqrt,                  start, '0)
+  `FFL(sign_q,              sign_d,                   start, '0)
+  `FFL(exp_offset_q,        exp_offset_d,             start, '0)
+  `FFL(b_all_ones_q,        b_all_ones,               start, '0)
+  `FFL(rnd_mode_q,          rnd_mode_i,               start, fpnew_pkg::RNE)
+  `FFL(dst_fmt_q,           dst_fmt_i,                start, fpnew_pkg::fp_format_e'(0))
+  `FFL(tag_q,               tag_i,                    start, TagType'('0))
+  `FFL(result_is_special_q, result_is_special,        start, '0)
+  `FFL(special_result_q,    special_result,           start, '0)
+  `FFL(special_status_q,    special_status,           start, '0)
+  `FFL(operand_a_q,         fmt_operand_a[dst_fmt_i], start, '0)
+  `FFL(operand_b_q,         fmt_operand_b[dst_fmt_i], start, '0)
+
+  // ----------------
+  // Iteration steps
+  // ----------------
+  typedef enum logic [1:0] {DST_Y, DST_Q, DST_R, DST_F} step_dst_e;
+
+  logic [Width-1:0] one, half, rec_all_ones;  // constants in the destination format
+  logic [Width-1:0] trunc_value, ulp_value;   // truncated result and its (half) ulp
+  logic             fma_result_zero;
+  step_dst_e        step_dst;
+
+  // Iteration registers: reciprocal (square root) y, quotient (root) q, remainder r, final result f
+  logic [Width-1:0] y_q, y_d, q_q, r_q, f_q;
+  logic             rem_trunc_zero_q; // the truncated result is exact
+
+  always_comb begin : step_decode
+    // Default assignments
+    fma_operands_o = '{default: fpnew_pkg::DONT_CARE};
+    fma_op_o       = fpnew_pkg::FNMSUB; // computes r = op2 - op0 * op1
+    fma_rnd_mode_o = fpnew_pkg::RNE;
+    step_dst       = DST_R;
+
+    unique case (step_q)
+      REC_ERR: begin
+        fma_operands_o[0] = operand_b_q;
+        fma_operands_o[1] = y_q;
+        fma_operands_o[2] = one;
+      end
+      REC_UPD: begin
+        fma_operands_o[0] = r_q;
+        fma_operands_o[1] = y_q;
+        fma_operands_o[2] = y_q;
+        fma_op_o          = fpnew_pkg::FMADD;
+        step_dst          = DST_Y;
+      end
+      QUOT: begin
+        fma_operands_o[0] = operand_a_q;
+        fma_operands_o[1] = y_q;
+        fma_op_o          = fpnew_pkg::MUL;
+        step_dst          = DST_Q;
+      end
+      QUOT_UPD: begin
+        fma_operands_o[0] = r_q;
+        fma_operands_o[1] = y_q;
+        fma_operands_o[2] = q_q;
+        fma_op_o          = fpnew_pkg::FMADD;
+        step_dst          = DST_Q;
+      end
+      ROOT: begin
+        fma_operands_o[0] = operand_b_q;
+        fma_operands_o[1] = y_q;
+        fma_op_o          = fpnew_pkg::MUL;
+        step_dst          = DST_Q;
+      end
+      ROOT_ERR: begin
+        fma_operands_o[0] = q_q;
+        fma_operands_o[1] = y_q;
+        fma_operands_o[2] = half;
+      end
+      ROOT_UPD: begin
+        fma_operands_o[0] = q_q;
+        fma_operands_o[1] = r_q;
+        fma_operands_o[2] = q_q;
+        fma_op_o          = fpnew_pkg::FMADD;
+        step_dst          = DST_Q;
+      end
+      RSQRT_UPD: begin
+        fma_operands_o[0] = y_q;
+        fma_operands_o[1] = r_q;
+        fma_operands_o[2] = y_q;
+        fma_op_o          = fpnew_pkg::FMADD;
+        step_dst          = DST_Y;
+      end
+      FINAL: begin
+        fma_operands_o[0] = r_q;
+        fma_operands_o[1] = y_q;
+        fma_operands_o[2] = q_q;
+        fma_op_o          = fpnew_pkg::FMADD;
+        fma_rnd_mode_o    = fpnew_pkg::RTZ;
+        step_dst          = DST_F;
+      end
+      REM_TRUNC: begin
+        fma_operands_o[0] = is_sqrt_q ? trunc_value : operand_b_q;
+        fma_operands_o[1] = trunc_value;
+        fma_operands_o[2] = operand_a_q;
+      end
+      REM_MID: begin
+        fma_operands_o[0] = is_sqrt_q ? trunc_value : operand_b_q;
+        fma_operands_o[1] = ulp_value;
+        fma_operands_o[2] = r_q;
+      end
+      default: begin // QUOT_REM, FINAL_REM
+        fma_operands_o[0] = is_sqrt_q ? q_q : operand_b_q;
+        fma_operands_o[1] = q_q;
+        fma_operands_o[2] = operand_a_q;
+      end
+    endcase
+  end
+
+  assign fma_fmt_o = dst_fmt_q;
+
+  // The iterations miss the reciprocal of divisors with all-ones mantissa, 1/b is rounded instead
+  always_comb begin : update_reciprocal
+    y_d = y_q;
+    if (start)
+      y_d = fmt_seed[dst_fmt_i];
+    else if (fma_done && step_dst == DST_Y)
+      y_d = b_all_ones_q ? rec_all_ones : fma_result_i;
+  end
+
+  `FF(y_q, y_d, '0)
+  `FFL(q_q,              fma_result_i,    fma_done && step_dst == DST_Q, '0)
+  `FFL(r_q,              fma_result_i,    fma_done && step_dst == DST_R, '0)
+  `FFL(f_q,              fma_result_i,    fma_done && step_dst == DST_F, '0)
+  `FFL(rem_trunc_zero_q, fma_result_zero, fma_done && step_q == REM_TRUNC, '0)
+
+  // -----------
+  // Truncation
+  // -----------
+  logic [NUM_FORMATS-1:0][Width-1:0] fmt_one, fmt_half, fmt_rec_all_ones;
+  logic [NUM_FORMATS-1:0][Width-1:0] fmt_trunc_value, fmt_ulp_value;
+  logic [NUM_FORMATS-1:0]            fmt_result_zero, fmt_of_before_round;
+
+  logic [NUM_FORMATS-1:0][SUPER_EXP_BITS+SUPER_MAN_BITS-1:0] fmt_pre_round_abs; // per format
+  logic [NUM_FORMATS-1:0][1:0]                               fmt_round_sticky_bits;
+
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_truncate
+    // Set up some constants
+    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned BIAS     = fpnew_pkg::bias(fpnew_pkg::fp_format_e'(fmt));
+    // The denormalization shift saturates once all significand bits are gone
+    localparam int unsigned SHIFT_AMOUNT_WIDTH = $clog2(MAN_BITS + 3);
+
+    typedef struct packed {
+      logic                sign;
+      logic [EXP_BITS-1:0] exponent;
+      logic [MAN_BITS-1:0] mantissa;
+    } fp_t;
+
+    if (FpFmtConfig[fmt]) begin : active_format
+      fp_t                           final_value, rem_value, trunc, ulp;
+      logic signed [EXP_WIDTH-1:0]   exponent; // biased exponent of the unscaled result
+      logic [MAN_BITS:0]             significand, truncated, denormalized;
+      logic [SHIFT_AMOUNT_WIDTH-1:0] denorm_shamt;
+      logic                          of_before_round, rem_mid_zero, round_bit, sticky_bit;
+
+      assign final_value = f_q[FP_WIDTH-1:0];
+      assign rem_value   = r_q[FP_WIDTH-1:0];
+      assign exponent    = signed'(EXP_WIDTH'(final_value.exponent)) + exp_offset_q;
+      assign significand = {1'b1, final_value.mantissa};
+
+      // Results below the normal range keep fewer significand bits, saturating the shift
+      always_comb begin : truncate
+        if (exponent >= 1)
+          denorm_shamt = '0;
+        else if (exponent <= -signed'(EXP_WIDTH'(MAN_BITS + 1)))
+          denorm_shamt = MAN_BITS + 2;
+        else
+          denorm_shamt = unsigned'(1 - exponent);
+
+        denormalized = significand >> denorm_shamt;
+        truncated    = denormalized << denorm_shamt;
+
+        // The truncated result is zero once the implicit bit is shifted out
+        if (truncated == '0)
+          trunc = '0;
+        else
+          trunc = '{sign: 1'b0, exponent: final_value.exponent, mantissa: truncated[MAN_BITS-1:0]};
+        // Half an ulp of the truncated result for DIV, a whole ulp for SQRT (c * ulp is twice the
+        // middle term of (c + ulp/2)^2)
+        ulp = '{sign:     1'b0,
+                exponent: final_value.exponent - (MAN_BITS + 1) + denorm_shamt + is_sqrt_q,
+                mantissa: '0};
+
+        // Initialize operands with ones (NaN-box)
+        fmt_trunc_value[fmt]               = '1;
+        fmt_trunc_value[fmt][FP_WIDTH-1:0] = trunc;
+        fmt_ulp_value[fmt]                 = '1;
+        fmt_ulp_value[fmt][FP_WIDTH-1:0]   = ulp;
+      end
+
+      // The midpoint is below the exact result for positive remainders. The remainder of the
+      // truncated result tells exact results apart from those below the midpoint, square roots
+      // can't be exactly on the midpoint.
+      assign rem_mid_zero = (rem_value.exponent == '0) && (rem_value.mantissa == '0);
+      assign round_bit    = ~rem_value.sign & ~(rem_mid_zero & is_sqrt_q);
+      assign sticky_bit   = rem_mid_zero ? is_sqrt_q : (~rem_value.sign | ~rem_trunc_zero_q);
+
+      // Classification before round. RISC-V mandates checking underflow AFTER rounding!
+      assign of_before_round = (exponent >= signed'(EXP_WIDTH'(2**EXP_BITS - 1)));
+
+      // Assemble result before rounding. In case of overflow, the largest normal value is set.
+      always_comb begin : assemble
+        if (of_before_round)
+          fmt_pre_round_abs[fmt] = {EXP_BITS'(2**EXP_BITS-2), {MAN_BITS{1'b1}}};
+        else if (exponent >= 1)
+          fmt_pre_round_abs[fmt] = {exponent[EXP_BITS-1:0], final_value.mantissa};
+        else
+          fmt_pre_round_abs[fmt] = {{EXP_BITS{1'b0}}, denormalized[MAN_BITS-1:0]}; // 0-extend
+      end
+      // In case of overflow, the round and sticky bits are set for proper rounding
+      assign fmt_round_sticky_bits[fmt][1] = round_bit | of_before_round;
+      assign fmt_round_sticky_bits[fmt][0] = sticky_bit | of_before_round;
+      assign fmt_of_before_round[fmt]      = of_before_round;
+
+      assign fmt_result_zero[fmt] = (fma_result_i[FP_WIDTH-2:0] == '0);
+
+      // The correctly rounded reciprocal of the largest mantissa 2 - ulp is 1/2 + ulp/2
+      always_comb begin : constants
+        // Initialize constants with ones (NaN-box)
+        fmt_one[fmt]                        = '1;
+        fmt_one[fmt][FP_WIDTH-1:0]          = fp_t'('{sign: 1'b0, exponent: BIAS, mantissa: '0});
+        fmt_half[fmt]                       = '1;
+        fmt_half[fmt][FP_WIDTH-1:0]         = fp_t'('{sign: 1'b0, exponent: BIAS-1, mantissa: '0});
+        fmt_rec_all_ones[fmt]               = '1;
+        fmt_rec_all_ones[fmt][FP_WIDTH-1:0] = fp_t'('{sign: 1'b0, exponent: BIAS-1, mantissa: 1});
+      end
+    end else begin : inactive_format
+      assign fmt_pre_round_abs[fmt]     = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_round_sticky_bits[fmt] = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_of_before_round[fmt]   = fpnew_pkg::DONT_CARE;
+      assign fmt_trunc_value[fmt]       = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_ulp_value[fmt]         = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_result_zero[fmt]       = fpnew_pkg::DONT_CARE;
+      assign fmt_one[fmt]               = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_half[fmt]              = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_rec_all_ones[fmt]      = '{default: fpnew_pkg::DONT_CARE};
+    end
+  end
+
+  assign one             = fmt_one[dst_fmt_q];
+  assign half            = fmt_half[dst_fmt_q];
+  assign rec_all_ones    = fmt_rec_all_ones[dst_fmt_q];
+  assign trunc_value     = fmt_trunc_value[dst_fmt_q];
+  assign ulp_value       = fmt_ulp_value[dst_fmt_q];
+  assign fma_result_zero = fmt_result_zero[dst_fmt_q];
+
+  // ----------------------------
+  // Rounding and classification
+  // ----------------------------
+  logic                                     pre_round_sign;
+  logic [SUPER_EXP_BITS+SUPER_MAN_BITS-1:0] pre_round_abs; // absolute value of result before rounding
+  logic [1:0]                               round_sticky_bits;
+
+  logic of_before_round, of_after_round; // overflow
+  logic uf_after_round;                  // underflow
+
+  logic [NUM_FORMATS-1:0] fmt_of_after_round;
+  logic [NUM_FORMATS-1:0] fmt_uf_after_round;
+
+  logic                                     rounded_sign;
+  logic [SUPER_EXP_BITS+SUPER_MAN_BITS-1:0] rounded_abs; // absolute value of result after rounding
+
+  assign pre_round_sign    = sign_q;
+  assign pre_round_abs     = fmt_pre_round_abs[dst_fmt_q];
+  assign round_sticky_bits = fmt_round_sticky_bits[dst_fmt_q];
+  assign of_before_round   = fmt_of_before_round[dst_fmt_q];
+
+  // Perform the rounding
+  fpnew_rounding #(
+    .AbsWidth ( SUPER_EXP_BITS + SUPER_MAN_BITS )
+  ) i_fpnew_rounding (
+    .abs_value_i             ( pre_round_abs     ),
+    .sign_i                  ( pre_round_sign    ),
+    .round_sticky_bits_i     ( round_sticky_bits ),
+    .rnd_mode_i              ( rnd_mode_q        ),
+    .effective_subtraction_i ( 1'b0              ),
+    .fraction_i              ( '0                ), // no stochastic rounding
+    .random_i                ( '0                ), // no stochastic rounding
+    .abs_rounded_o           ( rounded_abs       ),
+    .sign_o                  ( rounded_sign      ),
+    .exact_zero_o            ( /* unused */      )
+  );
+
+  logic [NUM_FORMATS-1:0][Width-1:0] fmt_result;
+
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_sign_inject
+    // Set up some constants
+    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+
+    if (FpFmtConfig[fmt]) begin : active_format
+      always_comb begin : post_process
+        // detect of / uf
+        fmt_uf_after_round[fmt] = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '0; // denormal
+        fmt_of_after_round[fmt] = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '1; // inf exp.
+
+        // Assemble regular result, nan box short ones.
+        fmt_result[fmt]               = '1;
+        fmt_result[fmt][FP_WIDTH-1:0] = {rounded_sign, rounded_abs[EXP_BITS+MAN_BITS-1:0]};
+      end
+    end else begin : inactive_format
+      assign fmt_uf_after_round[fmt] = fpnew_pkg::DONT_CARE;
+      assign fmt_of_after_round[fmt] = fpnew_pkg::DONT_CARE;
+      assign fmt_result[fmt]         = '{default: fpnew_pkg::DONT_CARE};
+    end
+  end
+
+  // Classification after rounding select by destination format
+  assign uf_after_round = fmt_uf_after_round[dst_fmt_q];
+  assign of_after_round = fmt_of_after_round[dst_fmt_q];
+
+  // -----------------
+  // Result selection
+  // -----------------
+  logic [Width-1:0]     regular_result;
+  fpnew_pkg::status_t   regular_status;
+
+  // Assemble regular result
+  assign regular_result    = fmt_result[dst_fmt_q];
+  assign regular_status.NV = 1'b0; // only valid cases are handled in regular path
+  assign regular_status.DZ = 1'b0; // division by zero is a special case
+  assign regular_status.OF = of_before_round | of_after_round;   // rounding can introduce overflow
+  assign regular_status.UF = uf_after_round & regular_status.NX; // only inexact results raise UF
+  assign regular_status.NX = (| round_sticky_bits) | of_before_round | of_after_round;
+
+  // Select output depending on special case detection
+  assign result_o        = result_is_special_q ? special_result_q : regular_result;
+  assign status_o        = result_is_special_q ? special_status_q : regular_status;
+  assign extension_bit_o = 1'b1; // always NaN-Box result
+  assign tag_o           = tag_q;
+  assign out_valid_o     = (state_q == DONE);
+  assign busy_o          = (state_q != IDLE);
+
+endmodule
@@ -0,0 +1,600 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License. You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+//
+// SPDX-License-Identifier: SHL-0.51
+
+// Author: agent <agent@local>
+
+`include "common_cells/registers.svh"
+
+// Iterative division and square root using a restoring radix-2 digit recurrence. StepsPerCycle
+// steps are chained per cycle, each computing one result bit, and each format only runs the
+// iterations needed for its precision.
+module fpnew_divsqrt_recurrence #(
+  parameter fpnew_pkg::fmt_logic_t    FpFmtConfig      = '1,
+  parameter int unsigned              StepsPerCycle    = 1, // radix-2 steps per cycle
+  // Precision in bits including the implicit bit for reduced-precision operations, 0 for full
+  parameter fpnew_pkg::fmt_unsigned_t ReducedPrecision = '{default: 0},
+  // Do not change
+  localparam int unsigned WIDTH       = fpnew_pkg::max_fp_width(FpFmtConfig),
+  localparam int unsigned NUM_FORMATS = fpnew_pkg::NUM_FP_FORMATS
+) (
+  input  logic                        clk_i,
+  input  logic                        rst_ni,
+  // Input signals
+  input  logic [1:0][WIDTH-1:0]       operands_i, // 2 operands
+  input  logic [NUM_FORMATS-1:0][1:0] is_boxed_i, // 2 operands
+  input  fpnew_pkg::roundmode_e       rnd_mode_i,
+  input  fpnew_pkg::operation_e       op_i,
+  input  fpnew_pkg::fp_format_e       dst_fmt_i,
+  input  logic                        reduced_prec_i, // compute with ReducedPrecision
+  // Control
+  input  logic                        start_i, // load a new operation, aborts the current one
+  input  logic                        kill_i,  // abort the current operation
+  output logic                        done_o,  // result is valid until the next operation starts
+  // Output signals
+  output logic [WIDTH-1:0]            result_o,
+  output fpnew_pkg::status_t          status_o
+);
+
+  // ----------
+  // Constants
+  // ----------
+  // The super-format that can hold all formats
+  localparam fpnew_pkg::fp_encoding_t SUPER_FORMAT = fpnew_pkg::super_format(FpFmtConfig);
+
+  localparam int unsigned SUPER_EXP_BITS = SUPER_FORMAT.exp_bits;
+  localparam int unsigned SUPER_MAN_BITS = SUPER_FORMAT.man_bits;
+
+  // Precision bits 'p' include the implicit bit
+  localparam int unsigned PRECISION_BITS = SUPER_MAN_BITS + 1;
+  // Result bits computed per iteration
+  localparam int unsigned BITS_PER_ITER = StepsPerCycle;
+
+  // The recurrence produces the p result bits and a round bit, rounded up to whole iterations
+  function automatic int unsigned result_bits(int unsigned precision);
+    return ((precision + 1 + BITS_PER_ITER - 1) / BITS_PER_ITER) * BITS_PER_ITER;
+  endfunction
+
+  // Precision of a format, possibly reduced
+  function automatic int unsigned precision(int unsigned fmt, logic reduced);
+    automatic int unsigned full_precision = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt)) + 1;
+    if (reduced && ReducedPrecision[fmt] > 0 && ReducedPrecision[fmt] < full_precision)
+      return ReducedPrecision[fmt];
+    else
+      return full_precision;
+  endfunction
+
+  // Number of iterations per format
+  function automatic fpnew_pkg::fmt_unsigned_t get_iterations(logic reduced);
+    automatic fpnew_pkg::fmt_unsigned_t res;
+    for (int unsigned fmt = 0; fmt < NUM_FORMATS; fmt++)
+      res[fmt] = result_bits(precision(fmt, reduced)) / BITS_PER_ITER;
+    return res;
+  endfunction
+
+  // Number of mantissa bits below the reduced precision per format
+  function automatic fpnew_pkg::fmt_unsigned_t get_round_shifts();
+    automatic fpnew_pkg::fmt_unsigned_t res;
+    for (int unsigned fmt = 0; fmt < NUM_FORMATS; fmt++)
+      res[fmt] = precision(fmt, 1'b0) - precision(fmt, 1'b1);
+    return res;
+  endfunction
+
+  localparam fpnew_pkg::fmt_unsigned_t ITERATIONS         = get_iterations(1'b0);
+  localparam fpnew_pkg::fmt_unsigned_t REDUCED_ITERATIONS = get_iterations(1'b1);
+  localparam fpnew_pkg::fmt_unsigned_t ROUND_SHIFTS       = get_round_shifts();
+
+  localparam int unsigned QUOT_BITS  = result_bits(PRECISION_BITS);
+  localparam int unsigned ITER_WIDTH = $clog2(QUOT_BITS / BITS_PER_ITER + 1);
+  // The square root remainder is bounded by twice the partial root and gets two new radicand bits
+  // per step. Division remainders are smaller than twice the divisor.
+  localparam int unsigned REM_WIDTH = QUOT_BITS + 4;
+  // The radicand holds the mantissa with two integer bits, two radicand bits per result bit
+  localparam int unsigned RADICAND_WIDTH = 2 * QUOT_BITS;
+  // Internal exponents need to hold the difference and sum of biased exponents
+  localparam int unsigned EXP_WIDTH = SUPER_EXP_BITS + 2;
+  // Denormalization shifts the quotient and its sticky bit out entirely at most
+  localparam int unsigned SHIFT_AMOUNT_WIDTH = $clog2(QUOT_BITS + 2);
+  localparam int unsigned LZC_RESULT_WIDTH   = $clog2(PRECISION_BITS);
+  // Reduced precision rounds up to SUPER_MAN_BITS positions higher
+  localparam int unsigned ROUND_SHIFT_WIDTH  = $clog2(PRECISION_BITS);
+
+  // -----------------
+  // Input processing
+  // -----------------
+  logic [NUM_FORMATS-1:0][1:0]                     fmt_sign;
+  logic [NUM_FORMATS-1:0][1:0][EXP_WIDTH-1:0]      fmt_exponent;
+  logic [NUM_FORMATS-1:0][1:0][PRECISION_BITS-1:0] fmt_mantissa; // left-aligned
+
+  fpnew_pkg::fp_info_t [NUM_FORMATS-1:0][1:0] fmt_info;
+
+  // FP Input initialization
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : fmt_init_inputs
+    // Set up some constants
+    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+
+    if (FpFmtConfig[fmt]) begin : active_format
+      logic [1:0][FP_WIDTH-1:0] trimmed_ops;
+
+      // Classify input
+      fpnew_classifier #(
+        .FpFormat    ( fpnew_pkg::fp_format_e'(fmt) ),
+        .NumOperands ( 2                            )
+      ) i_fpnew_classifier (
+        .operands_i ( trimmed_ops     ),
+        .is_boxed_i ( is_boxed_i[fmt] ),
+        .info_o     ( fmt_info[fmt]   )
+      );
+      for (genvar op = 0; op < 2; op++) begin : gen_operands
+        assign trimmed_ops[op]       = operands_i[op][FP_WIDTH-1:0];
+        assign fmt_sign[fmt][op]     = operands_i[op][FP_WIDTH-1];
+        // Real exponents are (ex = Ex - bias + 1 - nx), internal exponents stay biased
+        assign fmt_exponent[fmt][op] = operands_i[op][MAN_BITS+:EXP_BITS]
+                                       + fmt_info[fmt][op].is_subnormal;
+        assign fmt_mantissa[fmt][op] = {fmt_info[fmt][op].is_normal, operands_i[op][MAN_BITS-1:0]}
+                                       << (SUPER_MAN_BITS - MAN_BITS); // move to left of mantissa
+      end
+    end else begin : inactive_format
+      assign fmt_info[fmt]     = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_sign[fmt]     = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_exponent[fmt] = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_mantissa[fmt] = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+    end
+  end
+
+  fpnew_pkg::fp_info_t info_a, info_b;
+  logic                sign_a, sign_b;
+  logic                is_sqrt; // invalid operations run a square root
+
+  // Operation selection: DIV computes a / b, SQRT computes sqrt(a)
+  assign info_a  = fmt_info[dst_fmt_i][0];
+  assign info_b  = fmt_info[dst_fmt_i][1];
+  assign sign_a  = fmt_sign[dst_fmt_i][0];
+  assign sign_b  = fmt_sign[dst_fmt_i][1];
+  assign is_sqrt = (op_i != fpnew_pkg::DIV);
+
+  // ----------------------
+  // Special case handling
+  // ----------------------
+  logic [WIDTH-1:0]   special_result;
+  fpnew_pkg::status_t special_status;
+  logic               result_is_special;
+
+  logic [NUM_FORMATS-1:0][WIDTH-1:0] fmt_special_result;
+
+  typedef enum logic [1:0] {QNAN, INF, ZERO} special_value_e;
+  special_value_e special_value;
+  logic           special_sign;
+
+  always_comb begin : special_cases
+    // Default assignments
+    special_value     = QNAN; // canonical qNaN
+    special_sign      = 1'b0;
+    special_status    = '0;
+    result_is_special = 1'b0;
+
+    if (is_sqrt) begin
+      // NaN input causes canonical quiet NaN at the output and maybe invalid OP
+      if (info_a.is_nan) begin
+        result_is_special = 1'b1;
+        special_status.NV = info_a.is_signalling;
+      // Square root of zero is zero of the same sign
+      end else if (info_a.is_zero) begin
+        result_is_special = 1'b1;
+        special_value     = ZERO;
+        special_sign      = sign_a;
+      // Square root of a negative number (including -inf) is invalid
+      end else if (sign_a) begin
+        result_is_special = 1'b1;
+        special_status.NV = 1'b1;
+      // Square root of +inf is +inf
+      end else if (info_a.is_inf) begin
+        result_is_special = 1'b1;
+        special_value     = INF;
+      end
+    end else begin
+      // NaN inputs cause canonical quiet NaN at the output and maybe invalid OP
+      if (info_a.is_nan || info_b.is_nan) begin
+        result_is_special = 1'b1;
+        special_status.NV = info_a.is_signalling | info_b.is_signalling;
+      // inf / inf and 0 / 0 are invalid
+      end else if ((info_a.is_inf && info_b.is_inf) || (info_a.is_zero && info_b.is_zero)) begin
+        result_is_special = 1'b1;
+        special_status.NV = 1'b1;
+      // inf / x is inf, x / 0 is inf and raises division by zero for finite x
+      end else if (info_a.is_inf || info_b.is_zero) begin
+        result_is_special = 1'b1;
+        special_value     = INF;
+        special_sign      = sign_a ^ sign_b;
+        special_status.DZ = info_b.is_zero & ~info_a.is_inf;
+      // 0 / x and x / inf are zero
+      end else if (info_a.is_zero || info_b.is_inf) begin
+        result_is_special = 1'b1;
+        special_value     = ZERO;
+        special_sign      = sign_a ^ sign_b;
+      end
+    end
+  end
+
+  // Encode the special result in every format
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_special_results
+    // Set up some constants
+    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+
+    localparam logic [EXP_BITS-1:0] QNAN_EXPONENT = '1;
+    localparam logic [MAN_BITS-1:0] QNAN_MANTISSA = 2**(MAN_BITS-1);
+    localparam logic [MAN_BITS-1:0] ZERO_MANTISSA = '0;
+
+    if (FpFmtConfig[fmt]) begin : active_format
+      logic [FP_WIDTH-1:0] special_res;
+
+      always_comb begin : special_results
+        unique case (special_value)
+          INF:     special_res = {special_sign, QNAN_EXPONENT, ZERO_MANTISSA};
+          ZERO:    special_res = {special_sign, {EXP_BITS{1'b0}}, ZERO_MANTISSA};
+          default: special_res = {1'b0, QNAN_EXPONENT, QNAN_MANTISSA}; // qNaN
+        endcase
+        // Initialize special result with ones (NaN-box)
+        fmt_special_result[fmt]               = '1;
+        fmt_special_result[fmt][FP_WIDTH-1:0] = special_res;
+      end
+    end else begin : inactive_format
+      assign fmt_special_result[fmt] = '{default: fpnew_pkg::DONT_CARE};
+    end
+  end
+
+  assign special_result = fmt_special_result[dst_fmt_i];
+
+  // ----------------------
+  // Operand normalization
+  // ----------------------
+  logic [1:0][PRECISION_BITS-1:0] norm_mantissa; // mantissae in [1, 2)
+  logic [1:0][EXP_WIDTH-1:0]      norm_exponent; // signed biased exponents of the mantissae
+
+  // Subnormal operands are normalized by shifting out their leading zeroes
+  for (genvar op = 0; op < 2; op++) begin : gen_normalize
+    logic [PRECISION_BITS-1:0]   mantissa;
+    logic [LZC_RESULT_WIDTH-1:0] leading_zeros;
+    logic                        lzc_zeroes; // mantissa is zero, only for zero operands
+
+    assign mantissa = fmt_mantissa[dst_fmt_i][op];
+
+    lzc #(
+      .WIDTH ( PRECISION_BITS ),
+      .MODE  ( 1              ) // MODE = 1 counts leading zeroes
+    ) i_lzc (
+      .in_i    ( mantissa      ),
+      .cnt_o   ( leading_zeros ),
+      .empty_o ( lzc_zeroes    )
+    );
+
+    assign norm_mantissa[op] = mantissa << leading_zeros;
+    assign norm_exponent[op] = signed'(fmt_exponent[dst_fmt_i][op])
+                               - signed'({1'b0, leading_zeros});
+  end
+
+  // -----------------
+  // Recurrence setup
+  // -----------------
+  logic                        mantissa_a_smaller; // quotient would be below 1
+  logic                        exponent_a_odd;     // radicand is adjusted for even exponent
+  logic                        sign_d;
+  logic signed [EXP_WIDTH-1:0] exponent_d;
+  logic [REM_WIDTH-1:0]        remainder_init;
+  logic [RADICAND_WIDTH-1:0]   operand_init;       // radicand for SQRT, divisor for DIV
+
+  assign mantissa_a_smaller = (norm_mantissa[0] < norm_mantissa[1]);
+  // All biases are odd, so the unbiased exponent is odd for even biased exponents
+  assign exponent_a_odd     = ~norm_exponent[0][0];
+
+  always_comb begin : setup_recurrence
+    automatic int unsigned bias = fpnew_pkg::bias(dst_fmt_i);
+    if (is_sqrt) begin
+      // The radicand is brought into [1, 4) to make the exponent even, the root has half of it
+      sign_d         = sign_a;
+      exponent_d     = (signed'(norm_exponent[0]) + signed'(bias)
+                        - signed'({1'b0, exponent_a_odd})) >>> 1;
+      remainder_init = '0;
+      operand_init   = RADICAND_WIDTH'(norm_mantissa[0])
+                       << (RADICAND_WIDTH - PRECISION_BITS - 1 + exponent_a_odd);
+    end else begin
+      // The dividend is brought into [b, 2b) so the quotient is in [1, 2)
+      sign_d         = sign_a ^ sign_b;
+      exponent_d     = signed'(norm_exponent[0]) - signed'(norm_exponent[1]) + signed'(bias)
+                       - signed'({1'b0, mantissa_a_smaller});
+      remainder_init = REM_WIDTH'(norm_mantissa[0]) << mantissa_a_smaller;
+      operand_init   = RADICAND_WIDTH'(norm_mantissa[1]);
+    end
+  end
+
+  // --------
+  // Control
+  // --------
+  logic                  busy_q, busy_d, done_q, done_d;
+  logic [ITER_WIDTH-1:0] iter_cnt_q, iter_cnt_d;
+
+  // Count down the iterations of the current format, the result is held until the next start
+  always_comb begin : iteration_control
+    busy_d     = busy_q;
+    done_d     = done_q;
+    iter_cnt_d = iter_cnt_q;
+
+    if (busy_q) begin
+      iter_cnt_d = iter_cnt_q - 1;
+      if (iter_cnt_q == 1) begin
+        busy_d = 1'b0;
+        done_d = 1'b1;
+      end
+    end
+
+    if (start_i) begin
+      busy_d     = 1'b1;
+      done_d     = 1'b0;
+      iter_cnt_d = reduced_prec_i ? ITER_WIDTH'(REDUCED_ITERATIONS[dst_fmt_i])
+                                  : ITER_WIDTH'(ITERATIONS[dst_fmt_i]);
+    end
+
+    if (kill_i) begin
+      busy_d = 1'b0;
+      done_d = 1'b0;
+    end
+  end
+
+  `FF(busy_q, busy_d, 1'b0)
+  `FF(done_q, done_d, 1'b0)
+  `FF(iter_cnt_q, iter_cnt_d, '0)
+
+  // Hold information while the operation is in progress
+  logic                        is_sqrt_q;
+  logic                        sign_q;
+  logic signed [EXP_WIDTH-1:0] exponent_q;
+  fpnew_pkg::roundmode_e       rnd_mode_q;
+  fpnew_pkg::fp_format_e       dst_fmt_q;
+  logic                        reduced_prec_q;
+  logic                        result_is_special_q;
+  logic [WIDTH-1:0]            special_result_q;
+  fpnew_pkg::status_t          special_status_q;
+
+  // Fill the registers everytime a valid operation arrives (load FF, active low asynch rst)
+  `FFL(is_sqrt_q,           is_sqrt,           start_i, '0)
+  `FFL(sign_q,              sign_d,            start_i, '0)
+  `FFL(exponent_q,          exponent_d,        start_i, '0)
+  `FFL(rnd_mode_q,          rnd_mode_i,        start_i, fpnew_pkg::RNE)
+  `FFL(dst_fmt_q,           dst_fmt_i,         start_i, fpnew_pkg::fp_format_e'(0))
+  `FFL(reduced_prec_q,      reduced_prec_i,    start_i, '0)
+  `FFL(result_is_special_q, result_is_special, start_i, '0)
+  `FFL(special_result_q,    special_result,    start_i, '0)
+  `FFL(special_status_q,    special_status,    start_i, '0)
+
+  // -----------
+  // Recurrence
+  // -----------
+  logic [REM_WIDTH-1:0]      remainder_q, remainder_d;
+  logic [RADICAND_WIDTH-1:0] operand_q, operand_d;
+  logic [QUOT_BITS-1:0]      quotient_q, quotient_d;
+
+  // Restoring radix-2 steps, BITS_PER_ITER of them are chained per cycle:
+  // - DIV:  r' = 2 * (r - q_i * b),                              with q_i = (r >= b)
+  // - SQRT: r' = 4 * r + next radicand bits - q_i * (4 * Q + 1), with q_i = (r' >= 4 * Q + 1)
+  always_comb begin : recurrence
+    automatic logic [REM_WIDTH-1:0] partial_remainder, subtrahend;
+    automatic logic                 digit;
+
+    remainder_d = remainder_q;
+    operand_d   = operand_q;
+    quotient_d  = quotient_q;
+
+    for (int unsigned i = 0; i < BITS_PER_ITER; i++) begin
+      if (is_sqrt_q) begin
+        partial_remainder = {remainder_d[REM_WIDTH-3:0], operand_d[RADICAND_WIDTH-1 -: 2]};
+        subtrahend        = {quotient_d, 2'b01};
+      end else begin
+        partial_remainder = remainder_d;
+        subtrahend        = REM_WIDTH'(operand_d);
+      end
+
+      digit = (partial_remainder >= subtrahend);
+
+      remainder_d = digit ? partial_remainder - subtrahend : partial_remainder;
+      quotient_d  = {quotient_d[QUOT_BITS-2:0], digit};
+
+      if (is_sqrt_q) operand_d   = operand_d << 2; // consume two radicand bits
+      else           remainder_d = remainder_d << 1;
+    end
+
+    // A new operation initializes the recurrence
+    if (start_i) begin
+      remainder_d = remainder_init;
+      operand_d   = operand_init;
+      quotient_d  = '0;
+    end
+  end
+
+  `FFL(remainder_q, remainder_d, start_i | busy_q, '0)
+  `FFL(operand_q,   operand_d,   start_i | busy_q, '0)
+  `FFL(quotient_q,  quotient_d,  start_i | busy_q, '0)
+
+  // ----------------
+  // Denormalization
+  // ----------------
+  logic [QUOT_BITS-1:0]          aligned_quotient; // leading one at the MSB
+  logic [QUOT_BITS:0]            pre_denorm, denormalized, shifted_out; // quotient and sticky bit
+  logic [SHIFT_AMOUNT_WIDTH-1:0] denorm_shamt;
+  logic [SUPER_EXP_BITS-1:0]     final_exponent;
+  int unsigned                   num_iterations;
+
+  // Narrow formats ran fewer iterations, their result bits are at the bottom of the quotient
+  assign num_iterations   = reduced_prec_q ? REDUCED_ITERATIONS[dst_fmt_q] : ITERATIONS[dst_fmt_q];
+  assign aligned_quotient = quotient_q << (QUOT_BITS - num_iterations * BITS_PER_ITER);
+  // The remainder is nonzero for inexact results
+  assign pre_denorm       = {aligned_quotient, (| remainder_q)};
+
+  // Results below the normal range are shifted to the subnormal exponent, saturating the shift
+  always_comb begin : denormalize
+    if (exponent_q >= 1)
+      denorm_shamt = '0;
+    else if (exponent_q <= 1 - signed'(QUOT_BITS + 1))
+      denorm_shamt = QUOT_BITS + 1;
+    else
+      denorm_shamt = unsigned'(1 - exponent_q);
+
+    {denormalized, shifted_out} = {pre_denorm, (QUOT_BITS+1)'('0)} >> denorm_shamt;
+
+    final_exponent = (exponent_q >= 1) ? unsigned'(exponent_q[SUPER_EXP_BITS-1:0]) : '0;
+  end
+
+  // ----------------------------
+  // Rounding and classification
+  // ----------------------------
+  logic                                     pre_round_sign;
+  logic [SUPER_EXP_BITS+SUPER_MAN_BITS-1:0] pre_round_abs; // absolute value of result before rounding
+  logic [1:0]                               round_sticky_bits;
+
+  logic [ROUND_SHIFT_WIDTH-1:0]             round_shift; // reduced precision rounds higher up
+  logic [SUPER_EXP_BITS+SUPER_MAN_BITS-1:0] shifted_abs, shifted_rounded_abs;
+  logic [SUPER_MAN_BITS-1:0]                dropped_bits;
+  logic [1:0]                               shifted_round_sticky_bits;
+
+  logic of_before_round, of_after_round; // overflow
+  logic uf_after_round;                  // underflow
+
+  logic [NUM_FORMATS-1:0][SUPER_EXP_BITS+SUPER_MAN_BITS-1:0] fmt_pre_round_abs; // per format
+  logic [NUM_FORMATS-1:0][1:0]                               fmt_round_sticky_bits;
+
+  logic [NUM_FORMATS-1:0]                                    fmt_of_after_round;
+  logic [NUM_FORMATS-1:0]                                    fmt_uf_after_round;
+
+  logic                                     rounded_sign;
+  logic [SUPER_EXP_BITS+SUPER_MAN_BITS-1:0] rounded_abs; // absolute value of result after rounding
+
+  // Classification before round. RISC-V mandates checking underflow AFTER rounding!
+  assign of_before_round = int'(exponent_q) >= int'(2**fpnew_pkg::exp_bits(dst_fmt_q)) - 1;
+
+  // Pack exponent and mantissa into proper rounding form
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_res_assemble
+    // Set up some constants
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+
+    logic [EXP_BITS-1:0] pre_round_exponent;
+    logic [MAN_BITS-1:0] pre_round_mantissa;
+
+    if (FpFmtConfig[fmt]) begin : active_format
+      // The implicit bit is the MSB of the quotient, followed by the mantissa and the round bit
+      assign pre_round_exponent = (of_before_round) ? 2**EXP_BITS-2 : final_exponent[EXP_BITS-1:0];
+      assign pre_round_mantissa = (of_before_round) ? '1 : denormalized[QUOT_BITS-1-:MAN_BITS];
+      // Assemble result before rounding. In case of overflow, the largest normal value is set.
+      assign fmt_pre_round_abs[fmt] = {pre_round_exponent, pre_round_mantissa}; // 0-extend
+
+      // Round bit is after mantissa (1 in case of overflow for rounding)
+      assign fmt_round_sticky_bits[fmt][1] = denormalized[QUOT_BITS-1-MAN_BITS] | of_before_round;
+      // Remaining bits and the shifted-out bits to sticky (1 in case of overflow for rounding)
+      assign fmt_round_sticky_bits[fmt][0] = (| denormalized[QUOT_BITS-2-MAN_BITS:0]) |
+                                             (| shifted_out) | of_before_round;
+    end else begin : inactive_format
+      assign fmt_pre_round_abs[fmt]     = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_round_sticky_bits[fmt] = '{default: fpnew_pkg::DONT_CARE};
+    end
+  end
+
+  // Assemble result before rounding. In case of overflow, the largest normal value is set.
+  assign pre_round_sign    = sign_q;
+  assign pre_round_abs     = fmt_pre_round_abs[dst_fmt_q];
+
+  // In case of overflow, the round and sticky bits are set for proper rounding
+  assign round_sticky_bits = fmt_round_sticky_bits[dst_fmt_q];
+
+  // Reduced precision rounds at a higher position of the absolute value, the mantissa bits below it
+  // become round and sticky bits and are cleared after rounding
+  assign round_shift = reduced_prec_q ? ROUND_SHIFT_WIDTH'(ROUND_SHIFTS[dst_fmt_q]) : '0;
+
+  always_comb begin : reduce_precision
+    {shifted_abs, dropped_bits} = {pre_round_abs, SUPER_MAN_BITS'('0)} >> round_shift;
+
+    if (round_shift == '0)
+      shifted_round_sticky_bits = round_sticky_bits;
+    else
+      shifted_round_sticky_bits = {dropped_bits[SUPER_MAN_BITS-1],
+                                   (| dropped_bits[SUPER_MAN_BITS-2:0]) | (| round_sticky_bits)};
+  end
+
+  // Perform the rounding
+  fpnew_rounding #(
+    .AbsWidth ( SUPER_EXP_BITS + SUPER_MAN_BITS )
+  ) i_fpnew_rounding (
+    .abs_value_i             ( shifted_abs               ),
+    .sign_i                  ( pre_round_sign            ),
+    .round_sticky_bits_i     ( shifted_round_sticky_bits ),
+    .rnd_mode_i              ( rnd_mode_q                ),
+    .effective_subtraction_i ( 1'b0                      ),
+    .fraction_i              ( '0                        ), // no stochastic rounding
+    .random_i                ( '0                        ), // no stochastic rounding
+    .abs_rounded_o           ( shifted_rounded_abs       ),
+    .sign_o                  ( rounded_sign              ),
+    .exact_zero_o            ( /* unused */              )
+  );
+
+  assign rounded_abs = shifted_rounded_abs << round_shift;
+
+  logic [NUM_FORMATS-1:0][WIDTH-1:0] fmt_result;
+
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_sign_inject
+    // Set up some constants
+    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+
+    if (FpFmtConfig[fmt]) begin : active_format
+      always_comb begin : post_process
+        // detect of / uf
+        fmt_uf_after_round[fmt] = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '0; // denormal
+        fmt_of_after_round[fmt] = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '1; // inf exp.
+
+        // Assemble regular result, nan box short ones.
+        fmt_result[fmt]               = '1;
+        fmt_result[fmt][FP_WIDTH-1:0] = {rounded_sign, rounded_abs[EXP_BITS+MAN_BITS-1:0]};
+      end
+    end else begin : inactive_format
+      assign fmt_uf_after_round[fmt] = fpnew_pkg::DONT_CARE;
+      assign fmt_of_after_round[fmt] = fpnew_pkg::DONT_CARE;
+      assign fmt_result[fmt]         = '{default: fpnew_pkg::DONT_CARE};
+    end
+  end
+
+  // Classification after rounding select by destination format
+  assign uf_after_round = fmt_uf_after_round[dst_fmt_q];
+  assign of_after_round = fmt_of_after_round[dst_fmt_q];
+
+  // -----------------
+  // Result selection
+  // -----------------
+  logic [WIDTH-1:0]     regular_result;
+  fpnew_pkg::status_t   regular_status;
+
+  // Assemble regular result
+  assign regular_result    = fmt_result[dst_fmt_q];
+  assign regular_status.NV = 1'b0; // only valid cases are handled in regular path
+  assign regular_status.DZ = 1'b0; // division by zero is a special case
+  assign regular_status.OF = of_before_round | of_after_round;   // rounding can introduce overflow
+  assign regular_status.UF = uf_after_round & regular_status.NX; // only inexact results raise UF
+  assign regular_status.NX = (| shifted_round_sticky_bits) | of_before_round | of_after_round;
+
+  // Select output depending on special case detection
+  assign result_o = result_is_special_q ? special_result_q : regular_result;
+  assign status_o = result_is_special_q ? special_status_q : regular_status;
+  assign done_o   = done_q;
+
+endmodule
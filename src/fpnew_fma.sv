@@ -16,13 +16,20 @@
 `include "common_cells/registers.svh"
 
 module fpnew_fma #(
-  parameter fpnew_pkg::fp_format_e   FpFormat    = fpnew_pkg::fp_format_e'(0),
-  parameter int unsigned             NumPipeRegs = 0,
-  parameter fpnew_pkg::pipe_config_t PipeConfig  = fpnew_pkg::BEFORE,
-  parameter type                     TagType     = logic,
-  parameter type                     AuxType     = logic,
-
-  localparam int unsigned WIDTH = fpnew_pkg::fp_width(FpFormat) // do not change
+  parameter fpnew_pkg::fp_format_e   FpFormat        = fpnew_pkg::fp_format_e'(0),
+  parameter fpnew_pkg::fmt_logic_t   SrcFmtConfig    = '0, // narrower formats for the multiplicands
+  parameter fpnew_pkg::fmt_logic_t   FtzFmtConfig    = '0, // formats flushing subnormals to zero
+  parameter int unsigned             NumPipeRegs     = 0,
+  parameter fpnew_pkg::pipe_config_t PipeConfig      = fpnew_pkg::BEFORE,
+  parameter fpnew_pkg::mul_config_t  MulConfig       = fpnew_pkg::INFERRED_MUL,
+  parameter int unsigned             NumAccumulators = 0,
+  parameter type                     TagType         = logic,
+  parameter type                     AuxType         = logic,
+  parameter logic [31:0]             SrResetState    = fpnew_pkg::SR_RESET_SEED, // LFSR reset
+
+  localparam int unsigned WIDTH        = fpnew_pkg::fp_width(FpFormat), // do not change
+  localparam int unsigned ACC_ID_BITS  = fpnew_pkg::acc_id_bits(NumAccumulators), // do not change
+  localparam int unsigned SR_SEED_BITS = fpnew_pkg::SR_SEED_BITS // do not change
 ) (
   input logic                      clk_i,
   input logic                      rst_ni,
@@ -32,8 +39,14 @@ module fpnew_fma #(
   input fpnew_pkg::roundmode_e     rnd_mode_i,
   input fpnew_pkg::operation_e     op_i,
   input logic                      op_mod_i,
+  input fpnew_pkg::fp_format_e     src_fmt_i,
   input TagType                    tag_i,
   input AuxType                    aux_i,
+  input logic [ACC_ID_BITS-1:0]    acc_id_i,  // accumulator taking the result, 0 for none
+  input logic                      acc_fwd_i, // take the addend from accumulator acc_id_i
+  input fpnew_pkg::mx_scales_t     mx_scales_i, // MX block scales of the multiplicands
+  input logic [SR_SEED_BITS-1:0]   sr_seed_i,      // seed for stochastic rounding
+  input logic                      sr_seed_load_i, // load the seed
   // Input Handshake
   input  logic                     in_valid_i,
   output logic                     in_ready_o,
@@ -54,31 +67,48 @@ module fpnew_fma #(
   // ----------
   // Constants
   // ----------
+  localparam int unsigned NUM_FORMATS = fpnew_pkg::NUM_FP_FORMATS;
   localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(FpFormat);
   localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(FpFormat);
   localparam int unsigned BIAS     = fpnew_pkg::bias(FpFormat);
+  // Formats without infinities saturate to their largest finite value on overflow
+  localparam logic        NO_INF        = fpnew_pkg::NO_INF_FORMATS[FpFormat];
+  localparam int unsigned MAX_EXPONENT  = fpnew_pkg::max_exponent(FpFormat);
+  localparam int unsigned MAX_MANTISSA  = fpnew_pkg::max_mantissa(FpFormat);
+  localparam int unsigned QNAN_MANTISSA = fpnew_pkg::qnan_mantissa(FpFormat);
+  // Without subnormal support, subnormal inputs read as zero and tiny results flush to zero
+  localparam logic        FTZ           = FtzFmtConfig[FpFormat];
   // Precision bits 'p' include the implicit bit
   localparam int unsigned PRECISION_BITS = MAN_BITS + 1;
-  // The lower 2p+3 bits of the internal FMA result will be needed for leading-zero detection
-  localparam int unsigned LOWER_SUM_WIDTH  = 2 * PRECISION_BITS + 3;
-  localparam int unsigned LZC_RESULT_WIDTH = $clog2(LOWER_SUM_WIDTH);
+  // Leading zeroes are anticipated on the lower 2p+4 bits of the adder inputs, which hold the
+  // leading one of the sum (or the bit above it) whenever the count is needed
+  localparam int unsigned LZA_WIDTH        = 2 * PRECISION_BITS + 4;
+  localparam int unsigned LZC_RESULT_WIDTH = $clog2(LZA_WIDTH + 1);
   // Internal exponent width of FMA must accomodate all meaningful exponent values in order to avoid
-  // datapath leakage. This is either given by the exponent bits or the width of the LZC result.
+  // datapath leakage. This is either given by the exponent bits, the MX block scales applied to the
+  // product or the width of the LZC result.
   // In most reasonable FP formats the internal exponent will be wider than the LZC result.
-  localparam int unsigned EXP_WIDTH = unsigned'(fpnew_pkg::maximum(EXP_BITS + 2, LZC_RESULT_WIDTH));
-  // Shift amount width: maximum internal mantissa size is 3p+3 bits
-  localparam int unsigned SHIFT_AMOUNT_WIDTH = $clog2(3 * PRECISION_BITS + 3);
+  localparam int unsigned EXP_WIDTH =
+      unsigned'(fpnew_pkg::maximum(fpnew_pkg::maximum(EXP_BITS, fpnew_pkg::MX_SCALE_BITS) + 3,
+                                   LZC_RESULT_WIDTH));
+  // Shift amount width: shifts across the internal mantissa go up to 3p+4 bits
+  localparam int unsigned SHIFT_AMOUNT_WIDTH = $clog2(3 * PRECISION_BITS + 5);
+  // Random bits used by stochastic rounding
+  localparam int unsigned SR_BITS = fpnew_pkg::SR_BITS;
   // Pipelines
   localparam NUM_INP_REGS = PipeConfig == fpnew_pkg::BEFORE
                             ? NumPipeRegs
                             : (PipeConfig == fpnew_pkg::DISTRIBUTED
                                ? ((NumPipeRegs + 1) / 3) // Second to get distributed regs
                                : 0); // no regs here otherwise
-  localparam NUM_MID_REGS = PipeConfig == fpnew_pkg::INSIDE
-                          ? NumPipeRegs
-                          : (PipeConfig == fpnew_pkg::DISTRIBUTED
-                             ? ((NumPipeRegs + 2) / 3) // First to get distributed regs
-                             : 0); // no regs here otherwise
+  localparam NUM_INSIDE_REGS = PipeConfig == fpnew_pkg::INSIDE
+                             ? NumPipeRegs
+                             : (PipeConfig == fpnew_pkg::DISTRIBUTED
+                                ? ((NumPipeRegs + 2) / 3) // First to get distributed regs
+                                : 0); // no regs here otherwise
+  // Booth multipliers take the first half of the inside registers into their compressor tree
+  localparam NUM_MUL_REGS = (MulConfig == fpnew_pkg::BOOTH_MUL) ? NUM_INSIDE_REGS / 2 : 0;
+  localparam NUM_MID_REGS = NUM_INSIDE_REGS - NUM_MUL_REGS;
   localparam NUM_OUT_REGS = PipeConfig == fpnew_pkg::AFTER
                             ? NumPipeRegs
                             : (PipeConfig == fpnew_pkg::DISTRIBUTED
@@ -98,26 +128,34 @@ module fpnew_fma #(
   // Input pipeline
   // ---------------
   // Input pipeline signals, index i holds signal after i register stages
-  logic                  [0:NUM_INP_REGS][2:0][WIDTH-1:0] inp_pipe_operands_q;
-  logic                  [0:NUM_INP_REGS][2:0]            inp_pipe_is_boxed_q;
-  fpnew_pkg::roundmode_e [0:NUM_INP_REGS]                 inp_pipe_rnd_mode_q;
-  fpnew_pkg::operation_e [0:NUM_INP_REGS]                 inp_pipe_op_q;
-  logic                  [0:NUM_INP_REGS]                 inp_pipe_op_mod_q;
-  TagType                [0:NUM_INP_REGS]                 inp_pipe_tag_q;
-  AuxType                [0:NUM_INP_REGS]                 inp_pipe_aux_q;
-  logic                  [0:NUM_INP_REGS]                 inp_pipe_valid_q;
+  logic                  [0:NUM_INP_REGS][2:0][WIDTH-1:0]  inp_pipe_operands_q;
+  logic                  [0:NUM_INP_REGS][2:0]             inp_pipe_is_boxed_q;
+  fpnew_pkg::roundmode_e [0:NUM_INP_REGS]                  inp_pipe_rnd_mode_q;
+  fpnew_pkg::operation_e [0:NUM_INP_REGS]                  inp_pipe_op_q;
+  logic                  [0:NUM_INP_REGS]                  inp_pipe_op_mod_q;
+  fpnew_pkg::fp_format_e [0:NUM_INP_REGS]                  inp_pipe_src_fmt_q;
+  TagType                [0:NUM_INP_REGS]                  inp_pipe_tag_q;
+  AuxType                [0:NUM_INP_REGS]                  inp_pipe_aux_q;
+  logic                  [0:NUM_INP_REGS][ACC_ID_BITS-1:0] inp_pipe_acc_id_q;
+  logic                  [0:NUM_INP_REGS]                  inp_pipe_acc_fwd_q;
+  fpnew_pkg::mx_scales_t [0:NUM_INP_REGS]                  inp_pipe_mx_scales_q;
+  logic                  [0:NUM_INP_REGS]                  inp_pipe_valid_q;
   // Ready signal is combinatorial for all stages
   logic [0:NUM_INP_REGS] inp_pipe_ready;
 
   // Input stage: First element of pipeline is taken from inputs
-  assign inp_pipe_operands_q[0] = operands_i;
-  assign inp_pipe_is_boxed_q[0] = is_boxed_i;
-  assign inp_pipe_rnd_mode_q[0] = rnd_mode_i;
-  assign inp_pipe_op_q[0]       = op_i;
-  assign inp_pipe_op_mod_q[0]   = op_mod_i;
-  assign inp_pipe_tag_q[0]      = tag_i;
-  assign inp_pipe_aux_q[0]      = aux_i;
-  assign inp_pipe_valid_q[0]    = in_valid_i;
+  assign inp_pipe_operands_q[0]  = operands_i;
+  assign inp_pipe_is_boxed_q[0]  = is_boxed_i;
+  assign inp_pipe_rnd_mode_q[0]  = rnd_mode_i;
+  assign inp_pipe_op_q[0]        = op_i;
+  assign inp_pipe_op_mod_q[0]    = op_mod_i;
+  assign inp_pipe_src_fmt_q[0]   = src_fmt_i;
+  assign inp_pipe_tag_q[0]       = tag_i;
+  assign inp_pipe_aux_q[0]       = aux_i;
+  assign inp_pipe_acc_id_q[0]    = acc_id_i;
+  assign inp_pipe_acc_fwd_q[0]   = acc_fwd_i;
+  assign inp_pipe_mx_scales_q[0] = mx_scales_i;
+  assign inp_pipe_valid_q[0]     = in_valid_i;
   // Input stage: Propagate pipeline ready signal to updtream circuitry
   assign in_ready_o = inp_pipe_ready[0];
   // Generate the register stages
@@ -133,13 +171,47 @@ module fpnew_fma #(
     // Enable register if pipleine ready and a valid data item is present
     assign reg_ena = inp_pipe_ready[i] & inp_pipe_valid_q[i];
     // Generate the pipeline registers within the stages, use enable-registers
-    `FFL(inp_pipe_operands_q[i+1], inp_pipe_operands_q[i], reg_ena, '0)
-    `FFL(inp_pipe_is_boxed_q[i+1], inp_pipe_is_boxed_q[i], reg_ena, '0)
-    `FFL(inp_pipe_rnd_mode_q[i+1], inp_pipe_rnd_mode_q[i], reg_ena, fpnew_pkg::RNE)
-    `FFL(inp_pipe_op_q[i+1],       inp_pipe_op_q[i],       reg_ena, fpnew_pkg::FMADD)
-    `FFL(inp_pipe_op_mod_q[i+1],   inp_pipe_op_mod_q[i],   reg_ena, '0)
-    `FFL(inp_pipe_tag_q[i+1],      inp_pipe_tag_q[i],      reg_ena, TagType'('0))
-    `FFL(inp_pipe_aux_q[i+1],      inp_pipe_aux_q[i],      reg_ena, AuxType'('0))
+    `FFL(inp_pipe_operands_q[i+1],  inp_pipe_operands_q[i],  reg_ena, '0)
+    `FFL(inp_pipe_is_boxed_q[i+1],  inp_pipe_is_boxed_q[i],  reg_ena, '0)
+    `FFL(inp_pipe_rnd_mode_q[i+1],  inp_pipe_rnd_mode_q[i],  reg_ena, fpnew_pkg::RNE)
+    `FFL(inp_pipe_op_q[i+1],        inp_pipe_op_q[i],        reg_ena, fpnew_pkg::FMADD)
+    `FFL(inp_pipe_op_mod_q[i+1],    inp_pipe_op_mod_q[i],    reg_ena, '0)
+    `FFL(inp_pipe_src_fmt_q[i+1],   inp_pipe_src_fmt_q[i],   reg_ena, fpnew_pkg::fp_format_e'(0))
+    `FFL(inp_pipe_tag_q[i+1],       inp_pipe_tag_q[i],       reg_ena, TagType'('0))
+    `FFL(inp_pipe_aux_q[i+1],       inp_pipe_aux_q[i],       reg_ena, AuxType'('0))
+    `FFL(inp_pipe_acc_id_q[i+1],    inp_pipe_acc_id_q[i],    reg_ena, '0)
+    `FFL(inp_pipe_acc_fwd_q[i+1],   inp_pipe_acc_fwd_q[i],   reg_ena, '0)
+    `FFL(inp_pipe_mx_scales_q[i+1], inp_pipe_mx_scales_q[i], reg_ena, fpnew_pkg::MX_NO_SCALE)
+  end
+
+  // -----------------------
+  // Accumulator forwarding
+  // -----------------------
+  // The result of an operation can be kept in one of the accumulators of the unit. A dependent
+  // operation takes its addend from there at the alignment stage, in parallel to the multiplier,
+  // instead of waiting for the result to leave the unit and come back through the inputs.
+  logic [2**ACC_ID_BITS-1:0][WIDTH-1:0] acc_q;       // accumulators, unused IDs read as +0
+  logic                                 acc_forward; // the addend is taken from an accumulator
+  logic                                 acc_stall;   // the accumulator still awaits its result
+
+  // Selected pipeline output signals as non-arrays
+  logic [2:0][WIDTH-1:0] operands_q;
+  logic [2:0]            is_boxed_q;
+
+  if (NumAccumulators > 0) begin : gen_acc_forwarding
+    assign acc_forward = inp_pipe_acc_fwd_q[NUM_INP_REGS] & (| inp_pipe_acc_id_q[NUM_INP_REGS]);
+  end else begin : no_acc_forwarding
+    assign acc_forward = 1'b0;
+  end
+
+  // Accumulator values are results of this format and thus always properly boxed
+  always_comb begin : forward_addend
+    operands_q = inp_pipe_operands_q[NUM_INP_REGS];
+    is_boxed_q = inp_pipe_is_boxed_q[NUM_INP_REGS];
+    if (acc_forward) begin
+      operands_q[2] = acc_q[inp_pipe_acc_id_q[NUM_INP_REGS]];
+      is_boxed_q[2] = 1'b1;
+    end
   end
 
   // -----------------
@@ -152,11 +224,56 @@ module fpnew_fma #(
     .FpFormat    ( FpFormat ),
     .NumOperands ( 3        )
     ) i_class_inputs (
-    .operands_i ( inp_pipe_operands_q[NUM_INP_REGS] ),
-    .is_boxed_i ( inp_pipe_is_boxed_q[NUM_INP_REGS] ),
-    .info_o     ( info_q                            )
+    .operands_i ( operands_q ),
+    .is_boxed_i ( is_boxed_q ),
+    .info_o     ( info_q     )
   );
 
+  fp_t                 [NUM_FORMATS-1:0][1:0] src_operands;
+  fpnew_pkg::fp_info_t [NUM_FORMATS-1:0][1:0] src_info;
+
+  // Multiplicands in a narrower source format are rebiased into this format. Narrow subnormals
+  // stay unnormalized as the product datapath already copes with leading zeros.
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_src_formats
+    // Set up some constants
+    localparam int unsigned SRC_WIDTH    = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned SRC_EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned SRC_MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned SRC_BIAS     = fpnew_pkg::bias(fpnew_pkg::fp_format_e'(fmt));
+
+    if (SrcFmtConfig[fmt]) begin : active_format
+      logic [1:0][SRC_WIDTH-1:0] trimmed_ops;
+
+      fpnew_classifier #(
+        .FpFormat    ( fpnew_pkg::fp_format_e'(fmt) ),
+        .NumOperands ( 2                            )
+      ) i_class_src_inputs (
+        .operands_i ( trimmed_ops     ),
+        .is_boxed_i ( is_boxed_q[1:0] ),
+        .info_o     ( src_info[fmt]   )
+      );
+
+      for (genvar op = 0; op < 2; op++) begin : gen_operands
+        assign trimmed_ops[op] = operands_q[op][SRC_WIDTH-1:0];
+
+        assign src_operands[fmt][op].sign     = trimmed_ops[op][SRC_WIDTH-1];
+        assign src_operands[fmt][op].mantissa = MAN_BITS'(trimmed_ops[op][SRC_MAN_BITS-1:0])
+                                                << (MAN_BITS - SRC_MAN_BITS);
+        // Real exponents are kept, subnormals map to the rebiased minimum exponent
+        assign src_operands[fmt][op].exponent =
+            (src_info[fmt][op].is_inf || src_info[fmt][op].is_nan)
+            ? '1
+            : (src_info[fmt][op].is_zero
+               ? '0
+               : EXP_BITS'(trimmed_ops[op][SRC_MAN_BITS+:SRC_EXP_BITS])
+                 + EXP_BITS'(BIAS - SRC_BIAS));
+      end
+    end else begin : inactive_format
+      assign src_operands[fmt] = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign src_info[fmt]     = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+    end
+  end
+
   fp_t                 operand_a, operand_b, operand_c;
   fpnew_pkg::fp_info_t info_a,    info_b,    info_c;
 
@@ -173,14 +290,39 @@ module fpnew_fma #(
   // | *others* | \c -        | *invalid*
   // \note \c op_mod_q always inverts the sign of the addend.
   always_comb begin : op_select
+    logic daz_multiplicands; // the multiplicand format flushes subnormals to zero
 
     // Default assignments - packing-order-agnostic
-    operand_a = inp_pipe_operands_q[NUM_INP_REGS][0];
-    operand_b = inp_pipe_operands_q[NUM_INP_REGS][1];
-    operand_c = inp_pipe_operands_q[NUM_INP_REGS][2];
-    info_a    = info_q[0];
-    info_b    = info_q[1];
-    info_c    = info_q[2];
+    operand_a         = operands_q[0];
+    operand_b         = operands_q[1];
+    operand_c         = operands_q[2];
+    info_a            = info_q[0];
+    info_b            = info_q[1];
+    info_c            = info_q[2];
+    daz_multiplicands = FTZ;
+
+    // Widening operations take the multiplicands from the narrower source format
+    if (SrcFmtConfig[inp_pipe_src_fmt_q[NUM_INP_REGS]]) begin
+      operand_a         = src_operands[inp_pipe_src_fmt_q[NUM_INP_REGS]][0];
+      operand_b         = src_operands[inp_pipe_src_fmt_q[NUM_INP_REGS]][1];
+      info_a            = src_info[inp_pipe_src_fmt_q[NUM_INP_REGS]][0];
+      info_b            = src_info[inp_pipe_src_fmt_q[NUM_INP_REGS]][1];
+      daz_multiplicands = FtzFmtConfig[inp_pipe_src_fmt_q[NUM_INP_REGS]];
+    end
+
+    // Subnormal inputs of formats flushing to zero are zeroes of the same sign (DAZ)
+    if (daz_multiplicands && info_a.is_subnormal) begin
+      operand_a = '{sign: operand_a.sign, exponent: '0, mantissa: '0};
+      info_a    = '{is_zero: 1'b1, is_boxed: info_a.is_boxed, default: 1'b0};
+    end
+    if (daz_multiplicands && info_b.is_subnormal) begin
+      operand_b = '{sign: operand_b.sign, exponent: '0, mantissa: '0};
+      info_b    = '{is_zero: 1'b1, is_boxed: info_b.is_boxed, default: 1'b0};
+    end
+    if (FTZ && info_c.is_subnormal) begin
+      operand_c = '{sign: operand_c.sign, exponent: '0, mantissa: '0};
+      info_c    = '{is_zero: 1'b1, is_boxed: info_c.is_boxed, default: 1'b0};
+    end
 
     // op_mod_q inverts sign of operand C
     operand_c.sign = operand_c.sign ^ inp_pipe_op_mod_q[NUM_INP_REGS];
@@ -207,6 +349,26 @@ module fpnew_fma #(
     endcase
   end
 
+  // -----------------
+  // MX block scaling
+  // -----------------
+  logic signed [EXP_WIDTH-1:0] scale_offset; // exponent added to the product
+  logic                        scale_is_nan;
+
+  // The product is multiplied by the block scales of both multiplicands. Additions have no product
+  // to scale, they ignore the scales.
+  always_comb begin : mx_scaling
+    fpnew_pkg::mx_scales_t scales;
+    scales       = inp_pipe_mx_scales_q[NUM_INP_REGS];
+    scale_offset = signed'(EXP_WIDTH'(scales[0])) + signed'(EXP_WIDTH'(scales[1]))
+                   - signed'(EXP_WIDTH'(2 * fpnew_pkg::MX_SCALE_BIAS));
+    scale_is_nan = (scales[0] == '1) || (scales[1] == '1);
+    if (inp_pipe_op_q[NUM_INP_REGS] == fpnew_pkg::ADD) begin
+      scale_offset = '0;
+      scale_is_nan = 1'b0;
+    end
+  end
+
   // ---------------------
   // Input classification
   // ---------------------
@@ -234,15 +396,18 @@ module fpnew_fma #(
 
   always_comb begin : special_cases
     // Default assignments
-    special_result    = '{sign: 1'b0, exponent: '1, mantissa: 2**(MAN_BITS-1)}; // canonical qNaN
+    special_result    = '{sign: 1'b0, exponent: '1, mantissa: QNAN_MANTISSA}; // canonical qNaN
     special_status    = '0;
     result_is_special = 1'b0;
 
+    // A NaN block scale makes all elements of the block NaN, without raising a flag
+    if (scale_is_nan) begin
+      result_is_special = 1'b1; // bypass FMA, output is the canonical qNaN
     // Handle potentially mixed nan & infinity input => important for the case where infinity and
     // zero are multiplied and added to a qnan.
     // RISC-V mandates raising the NV exception in these cases:
     // (inf * 0) + c or (0 * inf) + c INVALID, no matter c (even quiet NaNs)
-    if ((info_a.is_inf && info_b.is_zero) || (info_a.is_zero && info_b.is_inf)) begin
+    end else if ((info_a.is_inf && info_b.is_zero) || (info_a.is_zero && info_b.is_inf)) begin
       result_is_special = 1'b1; // bypass FMA, output is the canonical qNaN
       special_status.NV = 1'b1; // invalid operation
     // NaN Inputs cause canonical quiet NaN at the output and maybe invalid OP
@@ -282,12 +447,12 @@ module fpnew_fma #(
   // Calculate internal exponents from encoded values. Real exponents are (ex = Ex - bias + 1 - nx)
   // with Ex the encoded exponent and nx the implicit bit. Internal exponents stay biased.
   assign exponent_addend = signed'(exponent_c + $signed({1'b0, ~info_c.is_normal})); // 0 as subnorm
-  // Biased product exponent is the sum of encoded exponents minus the bias.
+  // Biased product exponent is the sum of encoded exponents minus the bias, MX block scaled.
   assign exponent_product = (info_a.is_zero || info_b.is_zero)
                             ? 2 - signed'(BIAS) // in case the product is zero, set minimum exp.
                             : signed'(exponent_a + info_a.is_subnormal
                                       + exponent_b + info_b.is_subnormal
-                                      - signed'(BIAS));
+                                      - signed'(BIAS) + scale_offset);
   // Exponent difference is the addend exponent minus the product exponent
   assign exponent_difference = exponent_addend - exponent_product;
   // The tentative exponent will be the larger of the product or addend exponent
@@ -311,22 +476,14 @@ module fpnew_fma #(
   // ------------------
   // Product data path
   // ------------------
-  logic [PRECISION_BITS-1:0]   mantissa_a, mantissa_b, mantissa_c;
-  logic [2*PRECISION_BITS-1:0] product;             // the p*p product is 2p bits wide
-  logic [3*PRECISION_BITS+3:0] product_shifted;     // addends are 3p+4 bit wide (including G/R)
+  logic [PRECISION_BITS-1:0] mantissa_a, mantissa_b, mantissa_c;
 
   // Add implicit bits to mantissae
   assign mantissa_a = {info_a.is_normal, operand_a.mantissa};
   assign mantissa_b = {info_b.is_normal, operand_b.mantissa};
   assign mantissa_c = {info_c.is_normal, operand_c.mantissa};
 
-  // Mantissa multiplier (a*b)
-  assign product = mantissa_a * mantissa_b;
-
-  // Product is placed into a 3p+4 bit wide vector, padded with 2 bits for round and sticky:
-  // | 000...000 | product | RS |
-  //  <-  p+2  -> <-  2p -> < 2>
-  assign product_shifted = product << 2; // constant shift
+  // The mantissa multiplier (a*b) follows in the adder as it may span the product pipeline
 
   // -----------------
   // Addend data path
@@ -355,25 +512,187 @@ module fpnew_fma #(
   assign addend_shifted  = (effective_subtraction) ? ~addend_after_shift : addend_after_shift;
   assign inject_carry_in = effective_subtraction & ~sticky_before_add;
 
+  // -----------------
+  // Product pipeline
+  // -----------------
+  // Number of register enables passed to the multiplier, which has at least one enable input
+  localparam int unsigned NUM_MUL_ENA = fpnew_pkg::maximum(NUM_MUL_REGS, 1);
+  // Product pipeline signals, index i holds signal after i register stages. The registers inside a
+  // Booth multiplier are enabled along with these stages.
+  logic                  [0:NUM_MUL_REGS]                          mul_pipe_eff_sub_q;
+  logic                  [0:NUM_MUL_REGS]                          mul_pipe_tent_sign_q;
+  logic signed           [0:NUM_MUL_REGS][EXP_WIDTH-1:0]           mul_pipe_exp_prod_q;
+  logic signed           [0:NUM_MUL_REGS][EXP_WIDTH-1:0]           mul_pipe_exp_diff_q;
+  logic signed           [0:NUM_MUL_REGS][EXP_WIDTH-1:0]           mul_pipe_tent_exp_q;
+  logic                  [0:NUM_MUL_REGS][SHIFT_AMOUNT_WIDTH-1:0]  mul_pipe_add_shamt_q;
+  logic                  [0:NUM_MUL_REGS]                          mul_pipe_sticky_q;
+  logic                  [0:NUM_MUL_REGS][3*PRECISION_BITS+3:0]    mul_pipe_addend_q;
+  logic                  [0:NUM_MUL_REGS]                          mul_pipe_carry_in_q;
+  fpnew_pkg::roundmode_e [0:NUM_MUL_REGS]                          mul_pipe_rnd_mode_q;
+  logic                  [0:NUM_MUL_REGS]                          mul_pipe_res_is_spec_q;
+  fp_t                   [0:NUM_MUL_REGS]                          mul_pipe_spec_res_q;
+  fpnew_pkg::status_t    [0:NUM_MUL_REGS]                          mul_pipe_spec_stat_q;
+  TagType                [0:NUM_MUL_REGS]                          mul_pipe_tag_q;
+  AuxType                [0:NUM_MUL_REGS]                          mul_pipe_aux_q;
+  logic                  [0:NUM_MUL_REGS][ACC_ID_BITS-1:0]         mul_pipe_acc_id_q;
+  logic                  [0:NUM_MUL_REGS]                          mul_pipe_valid_q;
+  // Ready signal is combinatorial for all stages
+  logic [0:NUM_MUL_REGS] mul_pipe_ready;
+  // Register enables of the stages
+  logic [NUM_MUL_ENA-1:0] mul_pipe_reg_ena;
+
+  // Input stage: First element of pipeline is taken from upstream logic
+  assign mul_pipe_eff_sub_q[0]     = effective_subtraction;
+  assign mul_pipe_tent_sign_q[0]   = tentative_sign;
+  assign mul_pipe_exp_prod_q[0]    = exponent_product;
+  assign mul_pipe_exp_diff_q[0]    = exponent_difference;
+  assign mul_pipe_tent_exp_q[0]    = tentative_exponent;
+  assign mul_pipe_add_shamt_q[0]   = addend_shamt;
+  assign mul_pipe_sticky_q[0]      = sticky_before_add;
+  assign mul_pipe_addend_q[0]      = addend_shifted;
+  assign mul_pipe_carry_in_q[0]    = inject_carry_in;
+  assign mul_pipe_rnd_mode_q[0]    = inp_pipe_rnd_mode_q[NUM_INP_REGS];
+  assign mul_pipe_res_is_spec_q[0] = result_is_special;
+  assign mul_pipe_spec_res_q[0]    = special_result;
+  assign mul_pipe_spec_stat_q[0]   = special_status;
+  assign mul_pipe_tag_q[0]         = inp_pipe_tag_q[NUM_INP_REGS];
+  assign mul_pipe_aux_q[0]         = inp_pipe_aux_q[NUM_INP_REGS];
+  assign mul_pipe_acc_id_q[0]      = inp_pipe_acc_id_q[NUM_INP_REGS];
+  assign mul_pipe_valid_q[0]       = inp_pipe_valid_q[NUM_INP_REGS] & ~acc_stall;
+  // Input stage: Propagate pipeline ready signal to input pipe, hold back a stalled operation
+  assign inp_pipe_ready[NUM_INP_REGS] = mul_pipe_ready[0] & ~acc_stall;
+
+  // Enable register if pipleine ready and a valid data item is present
+  for (genvar i = 0; i < int'(NUM_MUL_ENA); i++) begin : gen_product_reg_ena
+    assign mul_pipe_reg_ena[i] = mul_pipe_ready[i] & mul_pipe_valid_q[i];
+  end
+
+  // Generate the register stages
+  for (genvar i = 0; i < NUM_MUL_REGS; i++) begin : gen_product_pipeline
+    // Determine the ready signal of the current stage - advance the pipeline:
+    // 1. if the next stage is ready for our data
+    // 2. if the next stage only holds a bubble (not valid) -> we can pop it
+    assign mul_pipe_ready[i] = mul_pipe_ready[i+1] | ~mul_pipe_valid_q[i+1];
+    // Valid: enabled by ready signal, synchronous clear with the flush signal
+    `FFLARNC(mul_pipe_valid_q[i+1], mul_pipe_valid_q[i], mul_pipe_ready[i], flush_i, 1'b0, clk_i, rst_ni)
+    // Generate the pipeline registers within the stages, use enable-registers
+    `FFL(mul_pipe_eff_sub_q[i+1],     mul_pipe_eff_sub_q[i],     mul_pipe_reg_ena[i], '0)
+    `FFL(mul_pipe_tent_sign_q[i+1],   mul_pipe_tent_sign_q[i],   mul_pipe_reg_ena[i], '0)
+    `FFL(mul_pipe_exp_prod_q[i+1],    mul_pipe_exp_prod_q[i],    mul_pipe_reg_ena[i], '0)
+    `FFL(mul_pipe_exp_diff_q[i+1],    mul_pipe_exp_diff_q[i],    mul_pipe_reg_ena[i], '0)
+    `FFL(mul_pipe_tent_exp_q[i+1],    mul_pipe_tent_exp_q[i],    mul_pipe_reg_ena[i], '0)
+    `FFL(mul_pipe_add_shamt_q[i+1],   mul_pipe_add_shamt_q[i],   mul_pipe_reg_ena[i], '0)
+    `FFL(mul_pipe_sticky_q[i+1],      mul_pipe_sticky_q[i],      mul_pipe_reg_ena[i], '0)
+    `FFL(mul_pipe_addend_q[i+1],      mul_pipe_addend_q[i],      mul_pipe_reg_ena[i], '0)
+    `FFL(mul_pipe_carry_in_q[i+1],    mul_pipe_carry_in_q[i],    mul_pipe_reg_ena[i], '0)
+    `FFL(mul_pipe_rnd_mode_q[i+1],    mul_pipe_rnd_mode_q[i],    mul_pipe_reg_ena[i], fpnew_pkg::RNE)
+    `FFL(mul_pipe_res_is_spec_q[i+1], mul_pipe_res_is_spec_q[i], mul_pipe_reg_ena[i], '0)
+    `FFL(mul_pipe_spec_res_q[i+1],    mul_pipe_spec_res_q[i],    mul_pipe_reg_ena[i], '0)
+    `FFL(mul_pipe_spec_stat_q[i+1],   mul_pipe_spec_stat_q[i],   mul_pipe_reg_ena[i], '0)
+    `FFL(mul_pipe_tag_q[i+1],         mul_pipe_tag_q[i],         mul_pipe_reg_ena[i], TagType'('0))
+    `FFL(mul_pipe_aux_q[i+1],         mul_pipe_aux_q[i],         mul_pipe_reg_ena[i], AuxType'('0))
+    `FFL(mul_pipe_acc_id_q[i+1],      mul_pipe_acc_id_q[i],      mul_pipe_reg_ena[i], '0)
+  end
+
   // ------
   // Adder
   // ------
+  logic [3*PRECISION_BITS+4:0] adder_a, adder_b; // operands of the carry-propagate adder
   logic [3*PRECISION_BITS+4:0] sum_raw;   // added one bit for the carry
   logic                        sum_carry; // observe carry bit from sum for sign fixing
   logic [3*PRECISION_BITS+3:0] sum;       // discard carry as sum won't overflow
   logic                        final_sign;
 
+  // The product is placed into a 3p+4 bit wide vector, padded with 2 bits for round and sticky:
+  // | 000...000 | product | RS |
+  //  <-  p+2  -> <-  2p -> < 2>
+  if (MulConfig == fpnew_pkg::BOOTH_MUL) begin : gen_booth_multiplier
+    logic [3*PRECISION_BITS+2:0] product_sum, product_carry; // carry-save product
+    logic [3*PRECISION_BITS+4:0] addend_ext;
+
+    // Mantissa multiplier (a*b), exact modulo the adder width to keep the sum carry meaningful
+    fpnew_booth_multiplier #(
+      .Width       ( PRECISION_BITS         ),
+      .ResultWidth ( 3 * PRECISION_BITS + 3 ),
+      .NumPipeRegs ( NUM_MUL_REGS           )
+    ) i_multiplier (
+      .clk_i,
+      .rst_ni,
+      .a_i       ( mantissa_a       ),
+      .b_i       ( mantissa_b       ),
+      .reg_ena_i ( mul_pipe_reg_ena ),
+      .sum_o     ( product_sum      ),
+      .carry_o   ( product_carry    )
+    );
+
+    assign addend_ext = mul_pipe_addend_q[NUM_MUL_REGS];
+
+    // The addend is merged into the carry-save product by a row of 3:2 compressors
+    assign adder_a = (product_sum << 2) ^ (product_carry << 2) ^ addend_ext;
+    assign adder_b = (((product_sum << 2) & (product_carry << 2))
+                      | ((product_sum << 2) & addend_ext)
+                      | ((product_carry << 2) & addend_ext)) << 1;
+  end else begin : gen_inferred_multiplier
+    logic [2*PRECISION_BITS-1:0] product; // the p*p product is 2p bits wide
+
+    // Mantissa multiplier (a*b), there are no product pipeline registers in this case
+    assign product = mantissa_a * mantissa_b;
+
+    assign adder_a = product << 2; // constant shift
+    assign adder_b = mul_pipe_addend_q[NUM_MUL_REGS];
+  end
+
   //Mantissa adder (ab+c). In normal addition, it cannot overflow.
-  assign sum_raw = product_shifted + addend_shifted + inject_carry_in;
+  assign sum_raw = adder_a + adder_b + mul_pipe_carry_in_q[NUM_MUL_REGS];
   assign sum_carry = sum_raw[3*PRECISION_BITS+4];
 
   // Complement negative sum (can only happen in subtraction -> overflows for positive results)
-  assign sum        = (effective_subtraction && ~sum_carry) ? -sum_raw : sum_raw;
+  assign sum        = (mul_pipe_eff_sub_q[NUM_MUL_REGS] && ~sum_carry) ? -sum_raw : sum_raw;
 
   // In case of a mispredicted subtraction result, do a sign flip
-  assign final_sign = (effective_subtraction && (sum_carry == tentative_sign))
+  assign final_sign = (mul_pipe_eff_sub_q[NUM_MUL_REGS]
+                       && (sum_carry == mul_pipe_tent_sign_q[NUM_MUL_REGS]))
                       ? 1'b1
-                      : (effective_subtraction ? 1'b0 : tentative_sign);
+                      : (mul_pipe_eff_sub_q[NUM_MUL_REGS] ? 1'b0
+                                                          : mul_pipe_tent_sign_q[NUM_MUL_REGS]);
+
+  // --------------------------
+  // Leading-zero anticipation
+  // --------------------------
+  logic [LZA_WIDTH+1:0]        lza_a, lza_b;       // adder inputs padded with a zero bit below
+  logic [LZA_WIDTH+1:0]        lza_transmit, lza_generate, lza_zero; // per-bit input pairs
+  logic [LZA_WIDTH-1:0]        lza_indicator;      // leading one marks the anticipated sum MSB
+  logic [LZC_RESULT_WIDTH-1:0] leading_zero_count; // the number of anticipated leading zeroes
+
+  // The leading one of the sum is anticipated from the adder inputs in parallel to the addition,
+  // such that only the normalization shift remains behind the adder. The zero bit padded below
+  // does not change the position of the leading one.
+  assign lza_a = {adder_a[LZA_WIDTH:0], 1'b0};
+  assign lza_b = {adder_b[LZA_WIDTH:0], 1'b0};
+
+  assign lza_transmit = lza_a ^ lza_b;
+  assign lza_generate = lza_a & lza_b;
+  assign lza_zero     = ~(lza_a | lza_b);
+
+  // An indicator bit is set where the string of sign bits of the two's complement sum can end. The
+  // first set bit is at the MSB of the magnitude of the sum, or one position off in either
+  // direction due to carries and the carry injected for subtractions.
+  for (genvar i = 0; i < LZA_WIDTH; i++) begin : gen_lza_indicator
+    assign lza_indicator[i] =
+        lza_transmit[i+2]
+        ? (lza_generate[i+1] & ~lza_zero[i]     | lza_zero[i+1]     & ~lza_generate[i])
+        : (lza_zero[i+1]     & ~lza_zero[i]     | lza_generate[i+1] & ~lza_generate[i]);
+  end
+
+  // Leading zero counter on the indicator, the appended one bounds the count for zero indicators
+  lzc #(
+    .WIDTH ( LZA_WIDTH + 1 ),
+    .MODE  ( 1             ) // MODE = 1 counts leading zeroes
+  ) i_lzc (
+    .in_i    ( {lza_indicator, 1'b1} ),
+    .cnt_o   ( leading_zero_count    ),
+    .empty_o ( /* unused */          )
+  );
 
   // ---------------
   // Internal pipeline
@@ -386,6 +705,7 @@ module fpnew_fma #(
   logic [SHIFT_AMOUNT_WIDTH-1:0] addend_shamt_q;
   logic                          sticky_before_add_q;
   logic [3*PRECISION_BITS+3:0]   sum_q;
+  logic [LZC_RESULT_WIDTH-1:0]   leading_zero_count_q;
   logic                          final_sign_q;
   fpnew_pkg::roundmode_e         rnd_mode_q;
   logic                          result_is_special_q;
@@ -399,6 +719,7 @@ module fpnew_fma #(
   logic                  [0:NUM_MID_REGS][SHIFT_AMOUNT_WIDTH-1:0] mid_pipe_add_shamt_q;
   logic                  [0:NUM_MID_REGS]                         mid_pipe_sticky_q;
   logic                  [0:NUM_MID_REGS][3*PRECISION_BITS+3:0]   mid_pipe_sum_q;
+  logic                  [0:NUM_MID_REGS][LZC_RESULT_WIDTH-1:0]   mid_pipe_lzc_q;
   logic                  [0:NUM_MID_REGS]                         mid_pipe_final_sign_q;
   fpnew_pkg::roundmode_e [0:NUM_MID_REGS]                         mid_pipe_rnd_mode_q;
   logic                  [0:NUM_MID_REGS]                         mid_pipe_res_is_spec_q;
@@ -406,28 +727,31 @@ module fpnew_fma #(
   fpnew_pkg::status_t    [0:NUM_MID_REGS]                         mid_pipe_spec_stat_q;
   TagType                [0:NUM_MID_REGS]                         mid_pipe_tag_q;
   AuxType                [0:NUM_MID_REGS]                         mid_pipe_aux_q;
+  logic                  [0:NUM_MID_REGS][ACC_ID_BITS-1:0]        mid_pipe_acc_id_q;
   logic                  [0:NUM_MID_REGS]                         mid_pipe_valid_q;
   // Ready signal is combinatorial for all stages
   logic [0:NUM_MID_REGS] mid_pipe_ready;
 
   // Input stage: First element of pipeline is taken from upstream logic
-  assign mid_pipe_eff_sub_q[0]     = effective_subtraction;
-  assign mid_pipe_exp_prod_q[0]    = exponent_product;
-  assign mid_pipe_exp_diff_q[0]    = exponent_difference;
-  assign mid_pipe_tent_exp_q[0]    = tentative_exponent;
-  assign mid_pipe_add_shamt_q[0]   = addend_shamt;
-  assign mid_pipe_sticky_q[0]      = sticky_before_add;
+  assign mid_pipe_eff_sub_q[0]     = mul_pipe_eff_sub_q[NUM_MUL_REGS];
+  assign mid_pipe_exp_prod_q[0]    = mul_pipe_exp_prod_q[NUM_MUL_REGS];
+  assign mid_pipe_exp_diff_q[0]    = mul_pipe_exp_diff_q[NUM_MUL_REGS];
+  assign mid_pipe_tent_exp_q[0]    = mul_pipe_tent_exp_q[NUM_MUL_REGS];
+  assign mid_pipe_add_shamt_q[0]   = mul_pipe_add_shamt_q[NUM_MUL_REGS];
+  assign mid_pipe_sticky_q[0]      = mul_pipe_sticky_q[NUM_MUL_REGS];
   assign mid_pipe_sum_q[0]         = sum;
+  assign mid_pipe_lzc_q[0]         = leading_zero_count;
   assign mid_pipe_final_sign_q[0]  = final_sign;
-  assign mid_pipe_rnd_mode_q[0]    = inp_pipe_rnd_mode_q[NUM_INP_REGS];
-  assign mid_pipe_res_is_spec_q[0] = result_is_special;
-  assign mid_pipe_spec_res_q[0]    = special_result;
-  assign mid_pipe_spec_stat_q[0]   = special_status;
-  assign mid_pipe_tag_q[0]         = inp_pipe_tag_q[NUM_INP_REGS];
-  assign mid_pipe_aux_q[0]         = inp_pipe_aux_q[NUM_INP_REGS];
-  assign mid_pipe_valid_q[0]       = inp_pipe_valid_q[NUM_INP_REGS];
-  // Input stage: Propagate pipeline ready signal to input pipe
-  assign inp_pipe_ready[NUM_INP_REGS] = mid_pipe_ready[0];
+  assign mid_pipe_rnd_mode_q[0]    = mul_pipe_rnd_mode_q[NUM_MUL_REGS];
+  assign mid_pipe_res_is_spec_q[0] = mul_pipe_res_is_spec_q[NUM_MUL_REGS];
+  assign mid_pipe_spec_res_q[0]    = mul_pipe_spec_res_q[NUM_MUL_REGS];
+  assign mid_pipe_spec_stat_q[0]   = mul_pipe_spec_stat_q[NUM_MUL_REGS];
+  assign mid_pipe_tag_q[0]         = mul_pipe_tag_q[NUM_MUL_REGS];
+  assign mid_pipe_aux_q[0]         = mul_pipe_aux_q[NUM_MUL_REGS];
+  assign mid_pipe_acc_id_q[0]      = mul_pipe_acc_id_q[NUM_MUL_REGS];
+  assign mid_pipe_valid_q[0]       = mul_pipe_valid_q[NUM_MUL_REGS];
+  // Input stage: Propagate pipeline ready signal to product pipe
+  assign mul_pipe_ready[NUM_MUL_REGS] = mid_pipe_ready[0];
 
   // Generate the register stages
   for (genvar i = 0; i < NUM_MID_REGS; i++) begin : gen_inside_pipeline
@@ -449,6 +773,7 @@ module fpnew_fma #(
     `FFL(mid_pipe_add_shamt_q[i+1],   mid_pipe_add_shamt_q[i],   reg_ena, '0)
     `FFL(mid_pipe_sticky_q[i+1],      mid_pipe_sticky_q[i],      reg_ena, '0)
     `FFL(mid_pipe_sum_q[i+1],         mid_pipe_sum_q[i],         reg_ena, '0)
+    `FFL(mid_pipe_lzc_q[i+1],         mid_pipe_lzc_q[i],         reg_ena, '0)
     `FFL(mid_pipe_final_sign_q[i+1],  mid_pipe_final_sign_q[i],  reg_ena, '0)
     `FFL(mid_pipe_rnd_mode_q[i+1],    mid_pipe_rnd_mode_q[i],    reg_ena, fpnew_pkg::RNE)
     `FFL(mid_pipe_res_is_spec_q[i+1], mid_pipe_res_is_spec_q[i], reg_ena, '0)
@@ -456,6 +781,7 @@ module fpnew_fma #(
     `FFL(mid_pipe_spec_stat_q[i+1],   mid_pipe_spec_stat_q[i],   reg_ena, '0)
     `FFL(mid_pipe_tag_q[i+1],         mid_pipe_tag_q[i],         reg_ena, TagType'('0))
     `FFL(mid_pipe_aux_q[i+1],         mid_pipe_aux_q[i],         reg_ena, AuxType'('0))
+    `FFL(mid_pipe_acc_id_q[i+1],      mid_pipe_acc_id_q[i],      reg_ena, '0)
   end
   // Output stage: assign selected pipe outputs to signals for later use
   assign effective_subtraction_q = mid_pipe_eff_sub_q[NUM_MID_REGS];
@@ -465,6 +791,7 @@ module fpnew_fma #(
   assign addend_shamt_q          = mid_pipe_add_shamt_q[NUM_MID_REGS];
   assign sticky_before_add_q     = mid_pipe_sticky_q[NUM_MID_REGS];
   assign sum_q                   = mid_pipe_sum_q[NUM_MID_REGS];
+  assign leading_zero_count_q    = mid_pipe_lzc_q[NUM_MID_REGS];
   assign final_sign_q            = mid_pipe_final_sign_q[NUM_MID_REGS];
   assign rnd_mode_q              = mid_pipe_rnd_mode_q[NUM_MID_REGS];
   assign result_is_special_q     = mid_pipe_res_is_spec_q[NUM_MID_REGS];
@@ -474,10 +801,8 @@ module fpnew_fma #(
   // --------------
   // Normalization
   // --------------
-  logic        [LOWER_SUM_WIDTH-1:0]  sum_lower;              // lower 2p+3 bits of sum are searched
-  logic        [LZC_RESULT_WIDTH-1:0] leading_zero_count;     // the number of leading zeroes
-  logic signed [LZC_RESULT_WIDTH:0]   leading_zero_count_sgn; // signed leading-zero count
-  logic                               lzc_zeroes;             // in case only zeroes found
+  logic signed [LZC_RESULT_WIDTH:0] leading_zero_count_sgn; // signed leading-zero count
+  logic                             sum_zero;               // in case the sum cancelled to zero
 
   logic        [SHIFT_AMOUNT_WIDTH-1:0] norm_shamt; // Normalization shift amount
   logic signed [EXP_WIDTH-1:0]          normalized_exponent;
@@ -489,34 +814,24 @@ module fpnew_fma #(
 
   logic signed [EXP_WIDTH-1:0] final_exponent;
 
-  assign sum_lower = sum_q[LOWER_SUM_WIDTH-1:0];
-
-  // Leading zero counter for cancellations
-  lzc #(
-    .WIDTH ( LOWER_SUM_WIDTH ),
-    .MODE  ( 1               ) // MODE = 1 counts leading zeroes
-  ) i_lzc (
-    .in_i    ( sum_lower          ),
-    .cnt_o   ( leading_zero_count ),
-    .empty_o ( lzc_zeroes         )
-  );
-
-  assign leading_zero_count_sgn = signed'({1'b0, leading_zero_count});
+  assign leading_zero_count_sgn = signed'({1'b0, leading_zero_count_q});
+  // Zero detection runs in parallel to the normalization shift
+  assign sum_zero               = ~(| sum_q);
 
-  // Normalization shift amount based on exponents and LZC (unsigned as only left shifts)
+  // Normalization shift amount based on exponents and LZA (unsigned as only left shifts)
   always_comb begin : norm_shift_amount
-    // Product-anchored case or cancellations require LZC
+    // Product-anchored case or cancellations require LZA
     if ((exponent_difference_q <= 0) || (effective_subtraction_q && (exponent_difference_q <= 2))) begin
-      // Normal result (biased exponent > 0 and not a zero)
-      if ((exponent_product_q - leading_zero_count_sgn + 1 >= 0) && !lzc_zeroes) begin
-        // Undo initial product shift, remove the counted zeroes
-        norm_shamt          = PRECISION_BITS + 2 + leading_zero_count;
-        normalized_exponent = exponent_product_q - leading_zero_count_sgn + 1; // account for shift
+      // Normal result (biased exponent > 0), without subnormals the shift is never capped
+      if (FTZ || (exponent_product_q - leading_zero_count_sgn + 2 >= 0)) begin
+        // Undo initial product shift, remove the anticipated zeroes to align with the sum MSB
+        norm_shamt          = PRECISION_BITS + leading_zero_count_q;
+        normalized_exponent = exponent_product_q - leading_zero_count_sgn + 3; // account for shift
       // Subnormal result
       end else begin
         // Cap the shift distance to align mantissa with minimum exponent
         norm_shamt          = unsigned'(signed'(PRECISION_BITS) + 2 + exponent_product_q);
-        normalized_exponent = 0; // subnormals encoded as 0
+        normalized_exponent = 1; // minimum exponent, subnormals are encoded as 0 below
       end
     // Addend-anchored case
     end else begin
@@ -528,8 +843,8 @@ module fpnew_fma #(
   // Do the large normalization shift
   assign sum_shifted       = sum_q << norm_shamt;
 
-  // The addend-anchored case needs a 1-bit normalization since the leading-one can be to the left
-  // or right of the (non-carry) MSB of the sum.
+  // The addend-anchored case and the anticipated leading-zero count need a 1-bit normalization
+  // since the leading-one can be to the left or right of the (non-carry) MSB of the sum.
   always_comb begin : small_norm
     // Default assignment, discarding carry bit
     {final_mantissa, sum_sticky_bits} = sum_shifted;
@@ -543,10 +858,10 @@ module fpnew_fma #(
     end else if (sum_shifted[3*PRECISION_BITS+3]) begin // check the sum MSB
       // do nothing
     // The normalized sum is still denormal, align left - unless the result is not already subnormal
-    end else if (normalized_exponent > 1) begin
+    end else if ((FTZ || normalized_exponent > 1) && !sum_zero) begin
       {final_mantissa, sum_sticky_bits} = sum_shifted << 1;
       final_exponent                    = normalized_exponent - 1;
-    // Otherwise we're denormal
+    // Otherwise we're denormal or zero
     end else begin
       final_exponent = '0;
     end
@@ -563,36 +878,54 @@ module fpnew_fma #(
   logic [MAN_BITS-1:0]          pre_round_mantissa;
   logic [EXP_BITS+MAN_BITS-1:0] pre_round_abs; // absolute value of result before rounding
   logic [1:0]                   round_sticky_bits;
+  logic [2*PRECISION_BITS+4:0]  round_fraction; // all bits below the rounding point
+  logic [SR_BITS-1:0]           sr_random;      // random bits for stochastic rounding
 
   logic of_before_round, of_after_round; // overflow
   logic uf_before_round, uf_after_round; // underflow
+  logic flush_to_zero;                   // tiny result flushed to zero
   logic result_zero;
 
   logic                         rounded_sign;
   logic [EXP_BITS+MAN_BITS-1:0] rounded_abs; // absolute value of result after rounding
 
   // Classification before round. RISC-V mandates checking underflow AFTER rounding!
-  assign of_before_round = final_exponent >= 2**(EXP_BITS)-1; // infinity exponent is all ones
+  // Values beyond the largest finite value overflow, with formats without infinities this includes
+  // the range covered by the NaN encoding
+  assign of_before_round = (final_exponent > signed'(MAX_EXPONENT))
+                           || (NO_INF && (final_exponent == signed'(MAX_EXPONENT))
+                                      && (final_mantissa[MAN_BITS:1] == '1));
   assign uf_before_round = final_exponent == 0;               // exponent for subnormals capped to 0
+  // Without subnormals, results below the smallest normal value before rounding become zero
+  assign flush_to_zero   = FTZ && (final_exponent < 1) && !sum_zero;
 
   // Assemble result before rounding. In case of overflow, the largest normal value is set.
   assign pre_round_sign     = final_sign_q;
-  assign pre_round_exponent = (of_before_round) ? 2**EXP_BITS-2 : unsigned'(final_exponent[EXP_BITS-1:0]);
-  assign pre_round_mantissa = (of_before_round) ? '1 : final_mantissa[MAN_BITS:1]; // bit 0 is R bit
+  assign pre_round_exponent = (of_before_round) ? MAX_EXPONENT
+                                                : unsigned'(final_exponent[EXP_BITS-1:0]);
+  assign pre_round_mantissa = (of_before_round) ? MAX_MANTISSA
+                                                : final_mantissa[MAN_BITS:1]; // bit 0 is R bit
   assign pre_round_abs      = {pre_round_exponent, pre_round_mantissa};
 
-  // In case of overflow, the round and sticky bits are set for proper rounding
+  // In case of overflow, the round and sticky bits are set for proper rounding. Stochastic rounding
+  // never rounds overflows up, like the units without random number generator.
   assign round_sticky_bits  = (of_before_round) ? 2'b11 : {final_mantissa[0], sticky_after_norm};
+  assign round_fraction     = (of_before_round)
+                              ? '0
+                              : {final_mantissa[0], sum_sticky_bits, sticky_before_add_q};
 
   // Perform the rounding
   fpnew_rounding #(
-    .AbsWidth ( EXP_BITS + MAN_BITS )
+    .AbsWidth  ( EXP_BITS + MAN_BITS    ),
+    .FracWidth ( 2 * PRECISION_BITS + 5 )
   ) i_fpnew_rounding (
     .abs_value_i             ( pre_round_abs           ),
     .sign_i                  ( pre_round_sign          ),
     .round_sticky_bits_i     ( round_sticky_bits       ),
     .rnd_mode_i              ( rnd_mode_q              ),
     .effective_subtraction_i ( effective_subtraction_q ),
+    .fraction_i              ( round_fraction          ),
+    .random_i                ( sr_random               ),
     .abs_rounded_o           ( rounded_abs             ),
     .sign_o                  ( rounded_sign            ),
     .exact_zero_o            ( result_zero             )
@@ -600,7 +933,9 @@ module fpnew_fma #(
 
   // Classification after rounding
   assign uf_after_round = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '0; // exponent = 0
-  assign of_after_round = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '1; // exponent all ones
+  assign of_after_round = NO_INF
+                          ? (rounded_abs == '1) // rounded onto the NaN encoding
+                          : (rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '1); // exponent all ones
 
   // -----------------
   // Result selection
@@ -608,13 +943,20 @@ module fpnew_fma #(
   logic [WIDTH-1:0]     regular_result;
   fpnew_pkg::status_t   regular_status;
 
-  // Assemble regular result
-  assign regular_result    = {rounded_sign, rounded_abs};
+  // Assemble regular result, formats without infinities saturate, flushed results are signed zeroes
+  assign regular_result    = flush_to_zero
+                             ? {pre_round_sign, (EXP_BITS+MAN_BITS)'('0)}
+                             : (NO_INF && of_after_round)
+                               ? {rounded_sign, EXP_BITS'(MAX_EXPONENT), MAN_BITS'(MAX_MANTISSA)}
+                               : {rounded_sign, rounded_abs};
   assign regular_status.NV = 1'b0; // only valid cases are handled in regular path
   assign regular_status.DZ = 1'b0; // no divisions
-  assign regular_status.OF = of_before_round | of_after_round;   // rounding can introduce overflow
-  assign regular_status.UF = uf_after_round & regular_status.NX; // only inexact results raise UF
-  assign regular_status.NX = (| round_sticky_bits) | of_before_round | of_after_round;
+  assign regular_status.OF = (of_before_round | of_after_round) // rounding can introduce overflow
+                             & ~flush_to_zero;
+  // Only inexact results raise UF, flushed results are always inexact
+  assign regular_status.UF = FTZ ? flush_to_zero : (uf_after_round & regular_status.NX);
+  assign regular_status.NX = (| round_sticky_bits) | of_before_round | of_after_round
+                             | flush_to_zero;
 
   // Final results for output pipeline
   fp_t                result_d;
@@ -671,5 +1013,55 @@ module fpnew_fma #(
   assign tag_o           = out_pipe_tag_q[NUM_OUT_REGS];
   assign aux_o           = out_pipe_aux_q[NUM_OUT_REGS];
   assign out_valid_o     = out_pipe_valid_q[NUM_OUT_REGS];
-  assign busy_o          = (| {inp_pipe_valid_q, mid_pipe_valid_q, out_pipe_valid_q});
+  assign busy_o          = (| {inp_pipe_valid_q, mul_pipe_valid_q, mid_pipe_valid_q, out_pipe_valid_q});
+
+  // -------------
+  // Accumulators
+  // -------------
+  // Results are written into their accumulator when entering the output pipeline
+  assign acc_q[0] = '0; // ID 0 selects no accumulator
+  for (genvar i = 1; i < 2**ACC_ID_BITS; i++) begin : gen_accumulators
+    if (i <= NumAccumulators) begin : active_accumulator
+      logic write;
+      assign write = out_pipe_valid_q[0] & out_pipe_ready[0]
+                     & (mid_pipe_acc_id_q[NUM_MID_REGS] == ACC_ID_BITS'(i));
+      `FFL(acc_q[i], result_d, write, '0)
+    end else begin : inactive_accumulator
+      assign acc_q[i] = '0;
+    end
+  end
+
+  // An operation taking the addend from an accumulator waits while a result for the same
+  // accumulator is still in the product or internal pipeline
+  always_comb begin : acc_pending
+    acc_stall = 1'b0;
+    for (int unsigned i = 1; i <= NUM_MUL_REGS; i++)
+      if (mul_pipe_valid_q[i] && mul_pipe_acc_id_q[i] == inp_pipe_acc_id_q[NUM_INP_REGS])
+        acc_stall = acc_forward;
+    for (int unsigned i = 1; i <= NUM_MID_REGS; i++)
+      if (mid_pipe_valid_q[i] && mid_pipe_acc_id_q[i] == inp_pipe_acc_id_q[NUM_INP_REGS])
+        acc_stall = acc_forward;
+  end
+
+  // --------------------
+  // Stochastic rounding
+  // --------------------
+  logic                    sr_draw; // a stochastically rounded result enters the output pipeline
+  logic [SR_SEED_BITS-1:0] lfsr_random;
+
+  assign sr_draw = out_pipe_valid_q[0] & out_pipe_ready[0] & (rnd_mode_q == fpnew_pkg::RSR);
+
+  // A new random value is drawn for each stochastically rounded result
+  fpnew_lfsr #(
+    .ResetState ( SrResetState )
+  ) i_lfsr (
+    .clk_i,
+    .rst_ni,
+    .seed_i   ( sr_seed_i      ),
+    .load_i   ( sr_seed_load_i ),
+    .en_i     ( sr_draw        ),
+    .random_o ( lfsr_random    )
+  );
+
+  assign sr_random = lfsr_random[SR_BITS-1:0];
 endmodule
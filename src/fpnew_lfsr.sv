@@ -0,0 +1,63 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License. You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+//
+// SPDX-License-Identifier: SHL-0.51
+
+// Author: agent <agent@local>
+
+`include "common_cells/registers.svh"
+
+// Galois LFSR supplying the random bits for stochastic rounding. The state advances by all of its
+// bits at once, such that successive random values share no bits. Loading a seed restarts the
+// sequence for reproducible results.
+module fpnew_lfsr #(
+  // State after reset, also taken instead of zero seeds. Must not be zero.
+  parameter logic [fpnew_pkg::SR_SEED_BITS-1:0] ResetState = fpnew_pkg::SR_RESET_SEED,
+  localparam int unsigned WIDTH = fpnew_pkg::SR_SEED_BITS // do not change
+) (
+  input  logic             clk_i,
+  input  logic             rst_ni,
+  // Seed, loaded instead of advancing the state
+  input  logic [WIDTH-1:0] seed_i,
+  input  logic             load_i,
+  // Advance to the next random value
+  input  logic             en_i,
+  output logic [WIDTH-1:0] random_o
+);
+
+  // ----------
+  // Constants
+  // ----------
+  // Primitive polynomial x^32 + x^22 + x^2 + x + 1 without its leading term
+  localparam logic [WIDTH-1:0] POLYNOMIAL = 32'h0040_0007;
+
+  // One step multiplies the state by x modulo the polynomial
+  function automatic logic [WIDTH-1:0] step(logic [WIDTH-1:0] state);
+    return (state << 1) ^ (state[WIDTH-1] ? POLYNOMIAL : '0);
+  endfunction
+
+  logic [WIDTH-1:0] state_d, state_q;
+
+  always_comb begin : next_state
+    state_d = state_q;
+    if (load_i) begin
+      // The all-zero state is never left, zero seeds load the reset state instead
+      state_d = (seed_i == '0) ? ResetState : seed_i;
+    end else if (en_i) begin
+      for (int unsigned i = 0; i < WIDTH; i++) state_d = step(state_d);
+    end
+  end
+
+  `FF(state_q, state_d, ResetState, clk_i, rst_ni)
+
+  assign random_o = state_q;
+
+endmodule
@@ -58,6 +58,19 @@ module fpnew_noncomp #(
   // ----------
   localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(FpFormat);
   localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(FpFormat);
+  localparam int unsigned BIAS     = fpnew_pkg::bias(FpFormat);
+  // Formats without infinities return their largest finite value instead
+  localparam logic        NO_INF        = fpnew_pkg::NO_INF_FORMATS[FpFormat];
+  localparam int unsigned MAX_EXPONENT  = fpnew_pkg::max_exponent(FpFormat);
+  localparam int unsigned MAX_MANTISSA  = fpnew_pkg::max_mantissa(FpFormat);
+  localparam int unsigned QNAN_MANTISSA = fpnew_pkg::qnan_mantissa(FpFormat);
+  localparam int unsigned INF_EXPONENT  = NO_INF ? MAX_EXPONENT : 2**EXP_BITS - 1;
+  localparam int unsigned INF_MANTISSA  = NO_INF ? MAX_MANTISSA : 0;
+  // Precision of the reciprocal estimates, limited by the mantissa width
+  localparam int unsigned EST_BITS = fpnew_pkg::est_bits(FpFormat);
+  // Signed exponent width for the estimates, holds 3*BIAS and normalized subnormal exponents
+  localparam int unsigned EST_EXP_WIDTH = EXP_BITS + 2;
+  localparam int unsigned LZC_RESULT_WIDTH = $clog2(MAN_BITS);
   // Pipelines
   localparam NUM_INP_REGS = (PipeConfig == fpnew_pkg::BEFORE || PipeConfig == fpnew_pkg::INSIDE)
                             ? NumPipeRegs
@@ -79,6 +92,29 @@ module fpnew_noncomp #(
     logic [MAN_BITS-1:0] mantissa;
   } fp_t;
 
+  // Lookup table for the estimates, indexed by the leading bits of the operand
+  typedef logic [2**EST_BITS-1:0][EST_BITS-1:0] est_table_t;
+
+  // ----------------
+  // Estimate tables
+  // ----------------
+  function automatic est_table_t rece_table();
+    automatic est_table_t res;
+    for (int unsigned i = 0; i < 2**EST_BITS; i++)
+      res[i] = EST_BITS'(fpnew_pkg::rece_entry(i, EST_BITS));
+    return res;
+  endfunction
+
+  function automatic est_table_t rsqrte_table();
+    automatic est_table_t res;
+    for (int unsigned i = 0; i < 2**EST_BITS; i++)
+      res[i] = EST_BITS'(fpnew_pkg::rsqrte_entry(i, EST_BITS));
+    return res;
+  endfunction
+
+  localparam est_table_t RECE_TABLE   = rece_table();
+  localparam est_table_t RSQRTE_TABLE = rsqrte_table();
+
   // ---------------
   // Input pipeline
   // ---------------
@@ -182,7 +218,7 @@ module fpnew_noncomp #(
     sgnj_result = operand_a; // result based on operand a
 
     // NaN-boxing check will treat invalid inputs as canonical NaNs
-    if (!info_a.is_boxed) sgnj_result = '{sign: 1'b0, exponent: '1, mantissa: 2**(MAN_BITS-1)};
+    if (!info_a.is_boxed) sgnj_result = '{sign: 1'b0, exponent: '1, mantissa: QNAN_MANTISSA};
 
     // Internal signs are treated as positive in case of non-NaN-boxed values
     sign_a = operand_a.sign & info_a.is_boxed;
@@ -221,7 +257,7 @@ module fpnew_noncomp #(
 
     // Both NaN inputs cause a NaN output
     if (info_a.is_nan && info_b.is_nan)
-      minmax_result = '{sign: 1'b0, exponent: '1, mantissa: 2**(MAN_BITS-1)}; // canonical qNaN
+      minmax_result = '{sign: 1'b0, exponent: '1, mantissa: QNAN_MANTISSA}; // canonical qNaN
     // If one operand is NaN, the non-NaN operand is returned
     else if (info_a.is_nan) minmax_result = operand_b;
     else if (info_b.is_nan) minmax_result = operand_a;
@@ -303,6 +339,116 @@ module fpnew_noncomp #(
   assign class_status        = '0;   // classification does not set flags
   assign class_extension_bit = 1'b0; // classification always produces results in integer registers
 
+  // ---------------------
+  // Reciprocal Estimates
+  // ---------------------
+  fp_t                est_result;
+  fpnew_pkg::status_t est_status;
+  logic               est_extension_bit;
+
+  logic [LZC_RESULT_WIDTH-1:0]     est_leading_zeros; // for normalizing subnormal operands
+  logic signed [EST_EXP_WIDTH-1:0] est_norm_exp, est_res_exp;
+  logic [MAN_BITS-1:0]             est_norm_man;
+
+  // Subnormal operands are normalized before the table lookup
+  lzc #(
+    .WIDTH ( MAN_BITS ),
+    .MODE  ( 1        ) // MODE = 1 counts leading zeroes
+  ) i_est_lzc (
+    .in_i    ( operand_a.mantissa ),
+    .cnt_o   ( est_leading_zeros  ),
+    .empty_o ( /* unused */       )
+  );
+
+  always_comb begin : normalize_estimate_operand
+    if (info_a.is_subnormal) begin
+      est_norm_exp = -signed'(EST_EXP_WIDTH'(est_leading_zeros));
+      est_norm_man = operand_a.mantissa << (est_leading_zeros + 1); // drop the leading one
+    end else begin
+      est_norm_exp = signed'(EST_EXP_WIDTH'(operand_a.exponent));
+      est_norm_man = operand_a.mantissa;
+    end
+  end
+
+  // Estimates - the EST_BITS mantissa MSBs of the result come from a table, the rest is zero.
+  // RECE: 1/x, the table is indexed by the operand mantissa MSBs
+  // RSQRTE: 1/sqrt(x), the table is indexed by the exponent LSB and the operand mantissa MSBs
+  always_comb begin : estimates
+    logic [EST_BITS-1:0] rece_index, rsqrte_index;
+    logic [MAN_BITS:0]   result_sig, shifted_sig; // with implicit bit
+
+    // Default assignment
+    est_status  = '0;
+    est_res_exp = '0;
+    shifted_sig = '0;
+
+    rece_index   = est_norm_man[MAN_BITS-1 -: EST_BITS];
+    rsqrte_index = {est_norm_exp[0], est_norm_man[MAN_BITS-1 -: EST_BITS-1]};
+
+    // Reciprocal square root
+    if (inp_pipe_op_q[NUM_INP_REGS] == fpnew_pkg::RSQRTE) begin
+      result_sig = {1'b1, MAN_BITS'(RSQRTE_TABLE[rsqrte_index]) << (MAN_BITS - EST_BITS)};
+      // NaNs and negative non-zero operands are invalid
+      if (info_a.is_nan || (operand_a.sign && !info_a.is_zero)) begin
+        est_result    = '{sign: 1'b0, exponent: '1, mantissa: QNAN_MANTISSA}; // canonical qNaN
+        est_status.NV = info_a.is_signalling || !info_a.is_nan;
+      // Division by zero, keep the sign
+      end else if (info_a.is_zero) begin
+        est_result    = '{sign: operand_a.sign, exponent: INF_EXPONENT, mantissa: INF_MANTISSA};
+        est_status.DZ = 1'b1;
+      end else if (info_a.is_inf) begin
+        est_result = '{sign: 1'b0, exponent: '0, mantissa: '0};
+      // The result is always normal
+      end else begin
+        est_res_exp = (signed'(EST_EXP_WIDTH'(3*BIAS - 1)) - est_norm_exp) >>> 1;
+        est_result  = '{sign:     1'b0,
+                        exponent: est_res_exp[EXP_BITS-1:0],
+                        mantissa: result_sig[MAN_BITS-1:0]};
+      end
+    // Reciprocal
+    end else begin
+      result_sig = {1'b1, MAN_BITS'(RECE_TABLE[rece_index]) << (MAN_BITS - EST_BITS)};
+      est_res_exp = signed'(EST_EXP_WIDTH'(2*BIAS - 1)) - est_norm_exp;
+      if (info_a.is_nan) begin
+        est_result    = '{sign: 1'b0, exponent: '1, mantissa: QNAN_MANTISSA}; // canonical qNaN
+        est_status.NV = info_a.is_signalling;
+      end else if (info_a.is_zero) begin
+        est_result    = '{sign: operand_a.sign, exponent: INF_EXPONENT, mantissa: INF_MANTISSA};
+        est_status.DZ = 1'b1;
+      end else if (info_a.is_inf) begin
+        est_result = '{sign: operand_a.sign, exponent: '0, mantissa: '0};
+      // Small subnormal operands overflow, result is infinity or the largest value by rounding mode
+      end else if (est_res_exp > signed'(EST_EXP_WIDTH'(2*BIAS))) begin
+        est_status.OF = 1'b1;
+        est_status.NX = 1'b1;
+        unique case (inp_pipe_rnd_mode_q[NUM_INP_REGS])
+          fpnew_pkg::RTZ:
+            est_result = '{sign: operand_a.sign, exponent: MAX_EXPONENT, mantissa: MAX_MANTISSA};
+          fpnew_pkg::RDN:
+            est_result = operand_a.sign
+                         ? '{sign: 1'b1, exponent: INF_EXPONENT, mantissa: INF_MANTISSA}
+                         : '{sign: 1'b0, exponent: MAX_EXPONENT, mantissa: MAX_MANTISSA};
+          fpnew_pkg::RUP:
+            est_result = operand_a.sign
+                         ? '{sign: 1'b1, exponent: MAX_EXPONENT, mantissa: MAX_MANTISSA}
+                         : '{sign: 1'b0, exponent: INF_EXPONENT, mantissa: INF_MANTISSA};
+          default:
+            est_result = '{sign: operand_a.sign, exponent: INF_EXPONENT, mantissa: INF_MANTISSA};
+        endcase
+      // Results with exponent 0 or -1 are subnormal, shift in the implicit bit
+      end else if (est_res_exp < 1) begin
+        shifted_sig = result_sig >> unsigned'(1 - est_res_exp);
+        est_result  = '{sign: operand_a.sign, exponent: '0, mantissa: shifted_sig[MAN_BITS-1:0]};
+      end else begin
+        est_result = '{sign:     operand_a.sign,
+                       exponent: est_res_exp[EXP_BITS-1:0],
+                       mantissa: result_sig[MAN_BITS-1:0]};
+      end
+    end
+  end
+
+  assign est_extension_bit = 1'b1; // NaN-box as result is always a float value
+
   // -----------------
   // Result selection
   // -----------------
@@ -334,6 +480,11 @@ module fpnew_noncomp #(
         status_d        = class_status;
         extension_bit_d = class_extension_bit;
       end
+      fpnew_pkg::RECE, fpnew_pkg::RSQRTE: begin
+        result_d        = est_result;
+        status_d        = est_status;
+        extension_bit_d = est_extension_bit;
+      end
       default: begin
         result_d        = '{default: fpnew_pkg::DONT_CARE}; // dont care
         status_d        = '{default: fpnew_pkg::DONT_CARE}; // dont care
@@ -14,19 +14,30 @@
 // Author: Stefan Mach <smach@iis.ee.ethz.ch>
 
 module fpnew_opgroup_block #(
-  parameter fpnew_pkg::opgroup_e        OpGroup       = fpnew_pkg::ADDMUL,
+  parameter fpnew_pkg::opgroup_e        OpGroup          = fpnew_pkg::ADDMUL,
   // FPU configuration
-  parameter int unsigned                Width         = 32,
-  parameter logic                       EnableVectors = 1'b1,
-  parameter fpnew_pkg::fmt_logic_t      FpFmtMask     = '1,
-  parameter fpnew_pkg::ifmt_logic_t     IntFmtMask    = '1,
-  parameter fpnew_pkg::fmt_unsigned_t   FmtPipeRegs   = '{default: 0},
-  parameter fpnew_pkg::fmt_unit_types_t FmtUnitTypes  = '{default: fpnew_pkg::PARALLEL},
-  parameter fpnew_pkg::pipe_config_t    PipeConfig    = fpnew_pkg::BEFORE,
-  parameter type                        TagType       = logic,
+  parameter int unsigned                Width            = 32,
+  parameter logic                       EnableVectors    = 1'b1,
+  parameter fpnew_pkg::fmt_logic_t      FpFmtMask        = '1,
+  parameter fpnew_pkg::ifmt_logic_t     IntFmtMask       = '1,
+  parameter fpnew_pkg::fmt_logic_t      FtzFmtMask       = '0, // flush subnormals (FMA and CONV)
+  parameter fpnew_pkg::fmt_unsigned_t   FmtPipeRegs      = '{default: 0},
+  parameter fpnew_pkg::fmt_unit_types_t FmtUnitTypes     = '{default: fpnew_pkg::PARALLEL},
+  parameter fpnew_pkg::pipe_config_t    PipeConfig       = fpnew_pkg::BEFORE,
+  parameter fpnew_pkg::arb_config_t     ArbConfig        = fpnew_pkg::ROUND_ROBIN,
+  parameter int unsigned                DivSqrtUnits     = 1, // replicated DIVSQRT units (MERGED)
+  parameter fpnew_pkg::divsqrt_config_t DivSqrtConfig    = fpnew_pkg::PULP_DIVSQRT,
+  parameter fpnew_pkg::fmt_unsigned_t   DivSqrtPrecision = '{default: 0}, // with op_mod, 0 for full
+  parameter fpnew_pkg::add_config_t     AddConfig        = fpnew_pkg::FMA_ADD,
+  parameter fpnew_pkg::fmt_unsigned_t   AddPipeRegs      = '{default: 0},
+  parameter fpnew_pkg::mul_config_t     MulConfig        = fpnew_pkg::INFERRED_MUL,
+  parameter int unsigned                NumAccumulators  = 0, // per FMA lane (ADDMUL)
+  parameter type                        TagType          = logic,
+  parameter int unsigned                StampWidth       = 1, // issue stamp bits (OLDEST_FIRST)
   // Do not change
   localparam int unsigned NUM_FORMATS  = fpnew_pkg::NUM_FP_FORMATS,
-  localparam int unsigned NUM_OPERANDS = fpnew_pkg::num_operands(OpGroup)
+  localparam int unsigned NUM_OPERANDS = fpnew_pkg::num_operands(OpGroup),
+  localparam int unsigned ACC_ID_BITS  = fpnew_pkg::acc_id_bits(NumAccumulators)
 ) (
   input logic                                     clk_i,
   input logic                                     rst_ni,
@@ -41,6 +52,11 @@ module fpnew_opgroup_block #(
   input fpnew_pkg::int_format_e                   int_fmt_i,
   input logic                                     vectorial_op_i,
   input TagType                                   tag_i,
+  input logic [ACC_ID_BITS-1:0]                   acc_id_i,
+  input logic                                     acc_fwd_i,
+  input fpnew_pkg::mx_scales_t                    mx_scales_i,
+  input logic [fpnew_pkg::SR_SEED_BITS-1:0]       sr_seed_i,
+  input logic                                     sr_seed_load_i,
   // Input Handshake
   input  logic                                    in_valid_i,
   output logic                                    in_ready_o,
@@ -57,6 +73,19 @@ module fpnew_opgroup_block #(
   output logic                                    busy_o
 );
 
+  // Formats the operations are issued to, dot product elements need no slice of their own
+  localparam fpnew_pkg::fmt_logic_t OPGROUP_FORMATS =
+      fpnew_pkg::get_opgroup_formats(OpGroup, FpFmtMask);
+  // Formats with a dual-path adder slice next to their FMA slice
+  localparam fpnew_pkg::fmt_logic_t ADD_FORMATS = (OpGroup == fpnew_pkg::ADDMUL)
+                                                  ? fpnew_pkg::get_add_formats(AddConfig,
+                                                                               FmtUnitTypes,
+                                                                               FpFmtMask,
+                                                                               FtzFmtMask)
+                                                  : '0;
+  // The adder slices are arbitrated along with the format slices
+  localparam int unsigned NUM_SLICES = (| ADD_FORMATS) ? 2 * NUM_FORMATS : NUM_FORMATS;
+
   // ----------------
   // Type Definition
   // ----------------
@@ -70,6 +99,15 @@ module fpnew_opgroup_block #(
   // Handshake signals for the slices
   logic [NUM_FORMATS-1:0] fmt_in_ready, fmt_out_valid, fmt_out_ready, fmt_busy;
   output_t [NUM_FORMATS-1:0] fmt_outputs;
+  // Handshake signals for the adder slices
+  logic [NUM_FORMATS-1:0] add_in_ready, add_out_valid, add_out_ready, add_busy;
+  output_t [NUM_FORMATS-1:0] add_outputs;
+  // Additions the dual-path adders can take: the random number generator for stochastic rounding
+  // and the accumulators are only found in the FMA
+  logic add_op;
+
+  assign add_op = (op_i == fpnew_pkg::ADD) & (rnd_mode_i != fpnew_pkg::RSR)
+                  & ~((NumAccumulators > 0) & ((acc_id_i != '0) | acc_fwd_i));
 
   // -----------
   // Input Side
@@ -81,37 +119,69 @@ module fpnew_opgroup_block #(
   // -------------------------
   for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_parallel_slices
     // Some constants for this format
-    localparam logic ANY_MERGED = fpnew_pkg::any_enabled_multi(FmtUnitTypes, FpFmtMask);
-    localparam logic IS_FIRST_MERGED =
-        fpnew_pkg::is_first_enabled_multi(fpnew_pkg::fp_format_e'(fmt), FmtUnitTypes, FpFmtMask);
+    localparam logic ANY_MERGED = fpnew_pkg::any_enabled_multi(FmtUnitTypes, OPGROUP_FORMATS);
+    localparam logic IS_FIRST_MERGED = fpnew_pkg::is_first_enabled_multi(
+        fpnew_pkg::fp_format_e'(fmt), FmtUnitTypes, OPGROUP_FORMATS);
 
     // Generate slice only if format enabled
-    if (FpFmtMask[fmt] && (FmtUnitTypes[fmt] == fpnew_pkg::PARALLEL)) begin : active_format
+    if (OPGROUP_FORMATS[fmt] && (FmtUnitTypes[fmt] == fpnew_pkg::PARALLEL)) begin : active_format
+      // Narrower formats the FMA accepts as multiplicands, or the dot product as elements
+      localparam fpnew_pkg::fmt_logic_t SRC_FORMATS =
+          (OpGroup == fpnew_pkg::ADDMUL)
+          ? fpnew_pkg::get_widening_formats(FpFmtMask, fpnew_pkg::fp_format_e'(fmt))
+          : (OpGroup == fpnew_pkg::DOTP)
+            ? fpnew_pkg::get_dotp_src_formats(FpFmtMask, fpnew_pkg::fmt_logic_t'(1 << fmt))
+            : '0;
 
-      logic in_valid;
+      logic                    in_valid, in_ready, is_add;
+      logic [NUM_OPERANDS-1:0] is_boxed;
 
-      assign in_valid = in_valid_i & (dst_fmt_i == fmt); // enable selected format
+      // Non-widening additions are steered to the dual-path adder if present
+      assign is_add   = ADD_FORMATS[fmt] & add_op & (src_fmt_i == fmt);
+      assign in_valid = in_valid_i & (dst_fmt_i == fmt) & ~is_add; // enable selected format
+
+      assign fmt_in_ready[fmt] = is_add ? add_in_ready[fmt] : in_ready;
+
+      // Multiplicands of widening operations are boxed with respect to the source format, packed
+      // dot product elements fill vectors of the destination format
+      always_comb begin : select_boxing
+        is_boxed = is_boxed_i[fmt];
+        if (OpGroup == fpnew_pkg::ADDMUL && SRC_FORMATS[src_fmt_i])
+          is_boxed[1:0] = is_boxed_i[src_fmt_i][1:0];
+      end
 
       fpnew_opgroup_fmt_slice #(
-        .OpGroup       ( OpGroup                      ),
-        .FpFormat      ( fpnew_pkg::fp_format_e'(fmt) ),
-        .Width         ( Width                        ),
-        .EnableVectors ( EnableVectors                ),
-        .NumPipeRegs   ( FmtPipeRegs[fmt]             ),
-        .PipeConfig    ( PipeConfig                   ),
-        .TagType       ( TagType                      )
+        .OpGroup          ( OpGroup                      ),
+        .FpFormat         ( fpnew_pkg::fp_format_e'(fmt) ),
+        .SrcFmtConfig     ( SRC_FORMATS                  ),
+        .FtzFmtConfig     ( FtzFmtMask                   ),
+        .Width            ( Width                        ),
+        .EnableVectors    ( EnableVectors                ),
+        .NumPipeRegs      ( FmtPipeRegs[fmt]             ),
+        .PipeConfig       ( PipeConfig                   ),
+        .DivSqrtConfig    ( DivSqrtConfig                ),
+        .DivSqrtPrecision ( DivSqrtPrecision[fmt]        ),
+        .MulConfig        ( MulConfig                    ),
+        .NumAccumulators  ( NumAccumulators              ),
+        .TagType          ( TagType                      )
       ) i_fmt_slice (
         .clk_i,
         .rst_ni,
         .operands_i     ( operands_i               ),
-        .is_boxed_i     ( is_boxed_i[fmt]          ),
+        .is_boxed_i     ( is_boxed                 ),
         .rnd_mode_i,
         .op_i,
         .op_mod_i,
+        .src_fmt_i,
         .vectorial_op_i,
         .tag_i,
+        .acc_id_i,
+        .acc_fwd_i,
+        .mx_scales_i,
+        .sr_seed_i,
+        .sr_seed_load_i,
         .in_valid_i     ( in_valid                 ),
-        .in_ready_o     ( fmt_in_ready[fmt]        ),
+        .in_ready_o     ( in_ready                 ),
         .flush_i,
         .result_o       ( fmt_outputs[fmt].result  ),
         .status_o       ( fmt_outputs[fmt].status  ),
@@ -122,9 +192,9 @@ module fpnew_opgroup_block #(
         .busy_o         ( fmt_busy[fmt]            )
       );
     // If the format wants to use merged ops, tie off the dangling ones not used here
-    end else if (FpFmtMask[fmt] && ANY_MERGED && !IS_FIRST_MERGED) begin : merged_unused
+    end else if (OPGROUP_FORMATS[fmt] && ANY_MERGED && !IS_FIRST_MERGED) begin : merged_unused
 
-      localparam FMT = fpnew_pkg::get_first_enabled_multi(FmtUnitTypes, FpFmtMask);
+      localparam FMT = fpnew_pkg::get_first_enabled_multi(FmtUnitTypes, OPGROUP_FORMATS);
       // Ready is split up into formats
       assign fmt_in_ready[fmt]  = fmt_in_ready[int'(FMT)];
 
@@ -137,7 +207,7 @@ module fpnew_opgroup_block #(
       assign fmt_outputs[fmt].tag     = TagType'(fpnew_pkg::DONT_CARE);
 
     // Tie off disabled formats
-    end else if (!FpFmtMask[fmt] || (FmtUnitTypes[fmt] == fpnew_pkg::DISABLED)) begin : disable_fmt
+    end else if (!OPGROUP_FORMATS[fmt] || (FmtUnitTypes[fmt] == fpnew_pkg::DISABLED)) begin : disable_fmt
       assign fmt_in_ready[fmt]  = 1'b0; // don't accept operations
       assign fmt_out_valid[fmt] = 1'b0; // don't emit values
       assign fmt_busy[fmt]      = 1'b0; // never busy
@@ -149,27 +219,93 @@ module fpnew_opgroup_block #(
     end
   end
 
+  // ---------------------------
+  // Generate Dual-Path Adders
+  // ---------------------------
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_add_slices
+    // Additions complete in their own slice with their own pipeline depth
+    if (ADD_FORMATS[fmt]) begin : active_format
+      logic in_valid;
+
+      assign in_valid = in_valid_i & (dst_fmt_i == fmt) & add_op & (src_fmt_i == fmt);
+
+      fpnew_opgroup_fmt_slice #(
+        .OpGroup       ( fpnew_pkg::ADDMUL            ),
+        .FpFormat      ( fpnew_pkg::fp_format_e'(fmt) ),
+        .DualPathAdder ( 1'b1                         ),
+        .Width         ( Width                        ),
+        .EnableVectors ( EnableVectors                ),
+        .NumPipeRegs   ( AddPipeRegs[fmt]             ),
+        .PipeConfig    ( PipeConfig                   ),
+        .TagType       ( TagType                      )
+      ) i_add_slice (
+        .clk_i,
+        .rst_ni,
+        .operands_i     ( operands_i               ),
+        .is_boxed_i     ( is_boxed_i[fmt]          ),
+        .rnd_mode_i,
+        .op_i,
+        .op_mod_i,
+        .src_fmt_i,
+        .vectorial_op_i,
+        .tag_i,
+        .acc_id_i       ( '0                       ), // additions don't use accumulators
+        .acc_fwd_i      ( 1'b0                     ),
+        .mx_scales_i    ( fpnew_pkg::MX_NO_SCALE   ), // additions don't scale
+        .sr_seed_i      ( '0                       ), // additions don't use stochastic rounding
+        .sr_seed_load_i ( 1'b0                     ),
+        .in_valid_i     ( in_valid                 ),
+        .in_ready_o     ( add_in_ready[fmt]        ),
+        .flush_i,
+        .result_o       ( add_outputs[fmt].result  ),
+        .status_o       ( add_outputs[fmt].status  ),
+        .extension_bit_o( add_outputs[fmt].ext_bit ),
+        .tag_o          ( add_outputs[fmt].tag     ),
+        .out_valid_o    ( add_out_valid[fmt]       ),
+        .out_ready_i    ( add_out_ready[fmt]       ),
+        .busy_o         ( add_busy[fmt]            )
+      );
+    // Tie off formats without adders
+    end else begin : disable_fmt
+      assign add_in_ready[fmt]  = 1'b0; // don't accept operations
+      assign add_out_valid[fmt] = 1'b0; // don't emit values
+      assign add_busy[fmt]      = 1'b0; // never busy
+      // Outputs are don't care
+      assign add_outputs[fmt].result  = '{default: fpnew_pkg::DONT_CARE};
+      assign add_outputs[fmt].status  = '{default: fpnew_pkg::DONT_CARE};
+      assign add_outputs[fmt].ext_bit = fpnew_pkg::DONT_CARE;
+      assign add_outputs[fmt].tag     = TagType'(fpnew_pkg::DONT_CARE);
+    end
+  end
+
   // ----------------------
   // Generate Merged Slice
   // ----------------------
-  if (fpnew_pkg::any_enabled_multi(FmtUnitTypes, FpFmtMask)) begin : gen_merged_slice
+  if (fpnew_pkg::any_enabled_multi(FmtUnitTypes, OPGROUP_FORMATS)) begin : gen_merged_slice
 
-    localparam FMT = fpnew_pkg::get_first_enabled_multi(FmtUnitTypes, FpFmtMask);
-    localparam REG = fpnew_pkg::get_num_regs_multi(FmtPipeRegs, FmtUnitTypes, FpFmtMask);
+    localparam FMT = fpnew_pkg::get_first_enabled_multi(FmtUnitTypes, OPGROUP_FORMATS);
+    localparam REG = fpnew_pkg::get_num_regs_multi(FmtPipeRegs, FmtUnitTypes, OPGROUP_FORMATS);
 
     logic in_valid;
 
-    assign in_valid = in_valid_i & (FmtUnitTypes[dst_fmt_i] == fpnew_pkg::MERGED);
+    assign in_valid = in_valid_i & (FmtUnitTypes[dst_fmt_i] == fpnew_pkg::MERGED)
+                      & OPGROUP_FORMATS[dst_fmt_i];
 
     fpnew_opgroup_multifmt_slice #(
-      .OpGroup       ( OpGroup          ),
-      .Width         ( Width            ),
-      .FpFmtConfig   ( FpFmtMask        ),
-      .IntFmtConfig  ( IntFmtMask       ),
-      .EnableVectors ( EnableVectors    ),
-      .NumPipeRegs   ( REG              ),
-      .PipeConfig    ( PipeConfig       ),
-      .TagType       ( TagType          )
+      .OpGroup          ( OpGroup          ),
+      .Width            ( Width            ),
+      .FpFmtConfig      ( FpFmtMask        ),
+      .IntFmtConfig     ( IntFmtMask       ),
+      .FtzFmtConfig     ( FtzFmtMask       ),
+      .EnableVectors    ( EnableVectors    ),
+      .NumPipeRegs      ( REG              ),
+      .PipeConfig       ( PipeConfig       ),
+      .TagType          ( TagType          ),
+      .DivSqrtUnits     ( DivSqrtUnits     ),
+      .DivSqrtConfig    ( DivSqrtConfig    ),
+      .DivSqrtPrecision ( DivSqrtPrecision ),
+      .MulConfig        ( MulConfig        ),
+      .NumAccumulators  ( NumAccumulators  )
     ) i_multifmt_slice (
       .clk_i,
       .rst_ni,
@@ -183,6 +319,11 @@ module fpnew_opgroup_block #(
       .int_fmt_i,
       .vectorial_op_i,
       .tag_i,
+      .acc_id_i,
+      .acc_fwd_i,
+      .mx_scales_i,
+      .sr_seed_i,
+      .sr_seed_load_i,
       .in_valid_i      ( in_valid                 ),
       .in_ready_o      ( fmt_in_ready[FMT]        ),
       .flush_i,
@@ -202,23 +343,47 @@ module fpnew_opgroup_block #(
   // ------------------
   output_t arbiter_output;
 
-  // Round-Robin arbiter to decide which result to use
-  rr_arb_tree #(
-    .NumIn     ( NUM_FORMATS ),
-    .DataType  ( output_t    ),
-    .AxiVldRdy ( 1'b1        )
+  logic    [NUM_SLICES-1:0]                 slice_out_valid, slice_out_ready;
+  output_t [NUM_SLICES-1:0]                 slice_outputs;
+  logic    [NUM_SLICES-1:0][StampWidth-1:0] slice_stamps;
+
+  // Adder slices are only arbitrated if present
+  if (| ADD_FORMATS) begin : gen_add_arbitration
+    assign slice_out_valid                = {add_out_valid, fmt_out_valid};
+    assign slice_outputs                  = {add_outputs, fmt_outputs};
+    assign {add_out_ready, fmt_out_ready} = slice_out_ready;
+  end else begin : gen_fmt_arbitration
+    assign slice_out_valid = fmt_out_valid;
+    assign slice_outputs   = fmt_outputs;
+    assign fmt_out_ready   = slice_out_ready;
+    assign add_out_ready   = '0;
+  end
+
+  // The issue stamp of an operation is carried in the low-order bits of its tag
+  for (genvar i = 0; i < int'(NUM_SLICES); i++) begin : gen_stamps
+    logic [$bits(TagType)-1:0] tag_bits;
+    assign tag_bits        = slice_outputs[i].tag;
+    assign slice_stamps[i] = tag_bits[StampWidth-1:0];
+  end
+
+  // Arbiter to decide which result to use
+  fpnew_arbiter #(
+    .NumIn      ( NUM_SLICES ),
+    .DataType   ( output_t   ),
+    .ArbConfig  ( ArbConfig  ),
+    .StampWidth ( StampWidth )
   ) i_arbiter (
     .clk_i,
     .rst_ni,
     .flush_i,
-    .rr_i   ( '0             ),
-    .req_i  ( fmt_out_valid  ),
-    .gnt_o  ( fmt_out_ready  ),
-    .data_i ( fmt_outputs    ),
-    .gnt_i  ( out_ready_i    ),
-    .req_o  ( out_valid_o    ),
-    .data_o ( arbiter_output ),
-    .idx_o  ( /* unused */   )
+    .req_i   ( slice_out_valid ),
+    .gnt_o   ( slice_out_ready ),
+    .data_i  ( slice_outputs   ),
+    .stamp_i ( slice_stamps    ),
+    .gnt_i   ( out_ready_i    ),
+    .req_o   ( out_valid_o    ),
+    .data_o  ( arbiter_output ),
+    .idx_o   ( /* unused */   )
   );
 
   // Unpack output
@@ -227,6 +392,6 @@ module fpnew_opgroup_block #(
   assign extension_bit_o = arbiter_output.ext_bit;
   assign tag_o           = arbiter_output.tag;
 
-  assign busy_o = (| fmt_busy);
+  assign busy_o = (| {fmt_busy, add_busy});
 
 endmodule
@@ -14,16 +14,25 @@
 // Author: Stefan Mach <smach@iis.ee.ethz.ch>
 
 module fpnew_opgroup_fmt_slice #(
-  parameter fpnew_pkg::opgroup_e     OpGroup       = fpnew_pkg::ADDMUL,
-  parameter fpnew_pkg::fp_format_e   FpFormat      = fpnew_pkg::fp_format_e'(0),
+  parameter fpnew_pkg::opgroup_e        OpGroup          = fpnew_pkg::ADDMUL,
+  parameter fpnew_pkg::fp_format_e      FpFormat         = fpnew_pkg::fp_format_e'(0),
+  parameter fpnew_pkg::fmt_logic_t      SrcFmtConfig     = '0, // narrower multiplicands/elements
+  parameter logic                       DualPathAdder    = 1'b0, // ADDMUL slice of adders only
+  parameter fpnew_pkg::fmt_logic_t      FtzFmtConfig     = '0, // formats flushing subnormals (FMA)
   // FPU configuration
-  parameter int unsigned             Width         = 32,
-  parameter logic                    EnableVectors = 1'b1,
-  parameter int unsigned             NumPipeRegs   = 0,
-  parameter fpnew_pkg::pipe_config_t PipeConfig    = fpnew_pkg::BEFORE,
-  parameter type                     TagType       = logic,
+  parameter int unsigned                Width            = 32,
+  parameter logic                       EnableVectors    = 1'b1,
+  parameter int unsigned                NumPipeRegs      = 0,
+  parameter fpnew_pkg::pipe_config_t    PipeConfig       = fpnew_pkg::BEFORE,
+  parameter fpnew_pkg::divsqrt_config_t DivSqrtConfig    = fpnew_pkg::PULP_DIVSQRT,
+  parameter int unsigned                DivSqrtPrecision = 0,
+  parameter fpnew_pkg::mul_config_t     MulConfig        = fpnew_pkg::INFERRED_MUL,
+  parameter int unsigned                NumAccumulators  = 0, // per FMA lane (ADDMUL)
+  parameter type                        TagType          = logic,
   // Do not change
-  localparam int unsigned NUM_OPERANDS = fpnew_pkg::num_operands(OpGroup)
+  localparam int unsigned NUM_OPERANDS  = fpnew_pkg::num_operands(OpGroup),
+  localparam int unsigned ACC_ID_BITS   = fpnew_pkg::acc_id_bits(NumAccumulators),
+  localparam int unsigned DIVSQRT_STEPS = (DivSqrtConfig == fpnew_pkg::RADIX2_X2) ? 2 : 1
 ) (
   input logic                               clk_i,
   input logic                               rst_ni,
@@ -33,8 +42,14 @@ module fpnew_opgroup_fmt_slice #(
   input fpnew_pkg::roundmode_e              rnd_mode_i,
   input fpnew_pkg::operation_e              op_i,
   input logic                               op_mod_i,
+  input fpnew_pkg::fp_format_e              src_fmt_i,
   input logic                               vectorial_op_i,
   input TagType                             tag_i,
+  input logic [ACC_ID_BITS-1:0]             acc_id_i,
+  input logic                               acc_fwd_i,
+  input fpnew_pkg::mx_scales_t              mx_scales_i,
+  input logic [fpnew_pkg::SR_SEED_BITS-1:0] sr_seed_i,
+  input logic                               sr_seed_load_i,
   // Input Handshake
   input  logic                              in_valid_i,
   output logic                              in_ready_o,
@@ -53,6 +68,9 @@ module fpnew_opgroup_fmt_slice #(
 
   localparam int unsigned FP_WIDTH  = fpnew_pkg::fp_width(FpFormat);
   localparam int unsigned NUM_LANES = fpnew_pkg::num_lanes(Width, FpFormat, EnableVectors);
+  // FMA lanes waiting for their accumulators must stall together, so they all take every operation
+  localparam logic LOCKSTEP_LANES = (OpGroup == fpnew_pkg::ADDMUL) && !DualPathAdder
+                                    && (NumAccumulators > 0);
 
 
   logic [NUM_LANES-1:0] lane_in_ready, lane_out_valid; // Handshake signals for the lanes
@@ -90,22 +108,70 @@ module fpnew_opgroup_fmt_slice #(
       logic [FP_WIDTH-1:0]                   op_result;      // lane-local results
       fpnew_pkg::status_t                    op_status;
 
-      assign in_valid = in_valid_i & ((lane == 0) | vectorial_op); // upper lanes only for vectors
+      logic lane_used; // the lane holds an element of the operation
+
+      assign lane_used = (lane == 0) | vectorial_op; // upper lanes only for vectors
+      assign in_valid  = in_valid_i & (lane_used | LOCKSTEP_LANES);
       // Slice out the operands for this lane
       always_comb begin : prepare_input
         for (int i = 0; i < int'(NUM_OPERANDS); i++) begin
           local_operands[i] = operands_i[i][(unsigned'(lane)+1)*FP_WIDTH-1:unsigned'(lane)*FP_WIDTH];
         end
+        // Multiplicands of widening FMAs are packed in the narrower source format
+        if (OpGroup == fpnew_pkg::ADDMUL && SrcFmtConfig[src_fmt_i]) begin
+          for (int i = 0; i < 2; i++) begin
+            local_operands[i] = operands_i[i] >> unsigned'(lane)*fpnew_pkg::fp_width(src_fmt_i);
+          end
+        end
+        // Unused lanes in lock-step see zero operands, their results and flags are discarded
+        if (LOCKSTEP_LANES && !lane_used) begin
+          local_operands = '0;
+        end
       end
 
       // Instantiate the operation from the selected opgroup
-      if (OpGroup == fpnew_pkg::ADDMUL) begin : lane_instance
-        fpnew_fma #(
+      if (OpGroup == fpnew_pkg::ADDMUL && DualPathAdder) begin : lane_instance
+        fpnew_add #(
           .FpFormat    ( FpFormat    ),
           .NumPipeRegs ( NumPipeRegs ),
           .PipeConfig  ( PipeConfig  ),
           .TagType     ( TagType     ),
           .AuxType     ( logic       )
+        ) i_add (
+          .clk_i,
+          .rst_ni,
+          .operands_i      ( local_operands               ),
+          .is_boxed_i      ( is_boxed_i[NUM_OPERANDS-1:0] ),
+          .rnd_mode_i,
+          .op_mod_i,
+          .tag_i,
+          .aux_i           ( vectorial_op         ), // Remember whether operation was vectorial
+          .in_valid_i      ( in_valid             ),
+          .in_ready_o      ( lane_in_ready[lane]  ),
+          .flush_i,
+          .result_o        ( op_result            ),
+          .status_o        ( op_status            ),
+          .extension_bit_o ( lane_ext_bit[lane]   ),
+          .tag_o           ( lane_tags[lane]      ),
+          .aux_o           ( lane_vectorial[lane] ),
+          .out_valid_o     ( out_valid            ),
+          .out_ready_i     ( out_ready            ),
+          .busy_o          ( lane_busy[lane]      )
+        );
+        assign lane_is_class[lane]   = 1'b0;
+        assign lane_class_mask[lane] = fpnew_pkg::NEGINF;
+      end else if (OpGroup == fpnew_pkg::ADDMUL) begin : lane_instance
+        fpnew_fma #(
+          .FpFormat        ( FpFormat        ),
+          .SrcFmtConfig    ( SrcFmtConfig    ),
+          .FtzFmtConfig    ( FtzFmtConfig    ),
+          .NumPipeRegs     ( NumPipeRegs     ),
+          .PipeConfig      ( PipeConfig      ),
+          .MulConfig       ( MulConfig       ),
+          .NumAccumulators ( NumAccumulators ),
+          .TagType         ( TagType         ),
+          .AuxType         ( logic           ),
+          .SrResetState    ( fpnew_pkg::sr_lane_seed(fpnew_pkg::SR_RESET_SEED, lane) )
         ) i_fma (
           .clk_i,
           .rst_ni,
@@ -114,8 +180,14 @@ module fpnew_opgroup_fmt_slice #(
           .rnd_mode_i,
           .op_i,
           .op_mod_i,
+          .src_fmt_i,
           .tag_i,
           .aux_i           ( vectorial_op         ), // Remember whether operation was vectorial
+          .acc_id_i,
+          .acc_fwd_i,
+          .mx_scales_i,
+          .sr_seed_i       ( fpnew_pkg::sr_lane_seed(sr_seed_i, lane) ),
+          .sr_seed_load_i,
           .in_valid_i      ( in_valid             ),
           .in_ready_o      ( lane_in_ready[lane]  ),
           .flush_i,
@@ -131,35 +203,38 @@ module fpnew_opgroup_fmt_slice #(
         assign lane_is_class[lane]   = 1'b0;
         assign lane_class_mask[lane] = fpnew_pkg::NEGINF;
       end else if (OpGroup == fpnew_pkg::DIVSQRT) begin : lane_instance
-        // fpnew_divsqrt #(
-        //   .FpFormat   (FpFormat),
-        //   .NumPipeRegs(NumPipeRegs),
-        //   .PipeConfig (PipeConfig),
-        //   .TagType    (TagType),
-        //   .AuxType    (logic)
-        // ) i_divsqrt (
-        //   .clk_i,
-        //   .rst_ni,
-        //   .operands_i      ( local_operands               ),
-        //   .is_boxed_i      ( is_boxed_i[NUM_OPERANDS-1:0] ),
-        //   .rnd_mode_i,
-        //   .op_i,
-        //   .op_mod_i,
-        //   .tag_i,
-        //   .aux_i           ( vectorial_op         ), // Remember whether operation was vectorial
-        //   .in_valid_i      ( in_valid             ),
-        //   .in_ready_o      ( lane_in_ready[lane]  ),
-        //   .flush_i,
-        //   .result_o        ( op_result            ),
-        //   .status_o        ( op_status            ),
-        //   .extension_bit_o ( lane_ext_bit[lane]   ),
-        //   .tag_o           ( lane_tags[lane]      ),
-        //   .aux_o           ( lane_vectorial[lane] ),
-        //   .out_valid_o     ( out_valid            ),
-        //   .out_ready_i     ( out_ready            ),
-        //   .busy_o          ( lane_busy[lane]      )
-        // );
-        // assign lane_is_class[lane] = 1'b0;
+        fpnew_divsqrt #(
+          .FpFormat         ( FpFormat         ),
+          .NumPipeRegs      ( NumPipeRegs      ),
+          .PipeConfig       ( PipeConfig       ),
+          .TagType          ( TagType          ),
+          .AuxType          ( logic            ),
+          .StepsPerCycle    ( DIVSQRT_STEPS    ),
+          .ReducedPrecision ( DivSqrtPrecision )
+        ) i_divsqrt (
+          .clk_i,
+          .rst_ni,
+          .operands_i      ( local_operands               ),
+          .is_boxed_i      ( is_boxed_i[NUM_OPERANDS-1:0] ),
+          .rnd_mode_i,
+          .op_i,
+          .op_mod_i,
+          .tag_i,
+          .aux_i           ( vectorial_op         ), // Remember whether operation was vectorial
+          .in_valid_i      ( in_valid             ),
+          .in_ready_o      ( lane_in_ready[lane]  ),
+          .flush_i,
+          .result_o        ( op_result            ),
+          .status_o        ( op_status            ),
+          .extension_bit_o ( lane_ext_bit[lane]   ),
+          .tag_o           ( lane_tags[lane]      ),
+          .aux_o           ( lane_vectorial[lane] ),
+          .out_valid_o     ( out_valid            ),
+          .out_ready_i     ( out_ready            ),
+          .busy_o          ( lane_busy[lane]      )
+        );
+        assign lane_is_class[lane]   = 1'b0;
+        assign lane_class_mask[lane] = fpnew_pkg::NEGINF;
       end else if (OpGroup == fpnew_pkg::NONCOMP) begin : lane_instance
         fpnew_noncomp #(
           .FpFormat   (FpFormat),
@@ -191,10 +266,43 @@ module fpnew_opgroup_fmt_slice #(
           .out_ready_i     ( out_ready             ),
           .busy_o          ( lane_busy[lane]       )
         );
+      end else if (OpGroup == fpnew_pkg::DOTP) begin : lane_instance
+        fpnew_sdotp_multi #(
+          .FpFmtConfig ( fpnew_pkg::fmt_logic_t'(1 << FpFormat) | SrcFmtConfig ),
+          .NumPipeRegs ( NumPipeRegs                                           ),
+          .PipeConfig  ( PipeConfig                                            ),
+          .TagType     ( TagType                                               ),
+          .AuxType     ( logic                                                 )
+        ) i_sdotp (
+          .clk_i,
+          .rst_ni,
+          .operands_i      ( local_operands               ),
+          .is_boxed_i      ( is_boxed_i[NUM_OPERANDS-1:0] ),
+          .rnd_mode_i,
+          .op_mod_i,
+          .src_fmt_i,
+          .dst_fmt_i       ( FpFormat             ),
+          .mx_scales_i,
+          .tag_i,
+          .aux_i           ( vectorial_op         ), // Remember whether operation was vectorial
+          .in_valid_i      ( in_valid             ),
+          .in_ready_o      ( lane_in_ready[lane]  ),
+          .flush_i,
+          .result_o        ( op_result            ),
+          .status_o        ( op_status            ),
+          .extension_bit_o ( lane_ext_bit[lane]   ),
+          .tag_o           ( lane_tags[lane]      ),
+          .aux_o           ( lane_vectorial[lane] ),
+          .out_valid_o     ( out_valid            ),
+          .out_ready_i     ( out_ready            ),
+          .busy_o          ( lane_busy[lane]      )
+        );
+        assign lane_is_class[lane]   = 1'b0;
+        assign lane_class_mask[lane] = fpnew_pkg::NEGINF;
       end // ADD OTHER OPTIONS HERE
 
-      // Handshakes are only done if the lane is actually used
-      assign out_ready            = out_ready_i & ((lane == 0) | result_is_vector);
+      // Handshakes are only done if the lane is actually used, lanes in lock-step always pop
+      assign out_ready            = out_ready_i & ((lane == 0) | result_is_vector | LOCKSTEP_LANES);
       assign lane_out_valid[lane] = out_valid   & ((lane == 0) | result_is_vector);
 
       // Properly NaN-box or sign-extend the slice result if not in use
@@ -16,17 +16,24 @@
 `include "common_cells/registers.svh"
 
 module fpnew_opgroup_multifmt_slice #(
-  parameter fpnew_pkg::opgroup_e     OpGroup       = fpnew_pkg::CONV,
-  parameter int unsigned             Width         = 64,
+  parameter fpnew_pkg::opgroup_e        OpGroup          = fpnew_pkg::CONV,
+  parameter int unsigned                Width            = 64,
   // FPU configuration
-  parameter fpnew_pkg::fmt_logic_t   FpFmtConfig   = '1,
-  parameter fpnew_pkg::ifmt_logic_t  IntFmtConfig  = '1,
-  parameter logic                    EnableVectors = 1'b1,
-  parameter int unsigned             NumPipeRegs   = 0,
-  parameter fpnew_pkg::pipe_config_t PipeConfig    = fpnew_pkg::BEFORE,
-  parameter type                     TagType       = logic,
+  parameter fpnew_pkg::fmt_logic_t      FpFmtConfig      = '1,
+  parameter fpnew_pkg::ifmt_logic_t     IntFmtConfig     = '1,
+  parameter fpnew_pkg::fmt_logic_t      FtzFmtConfig     = '0, // formats flushing subnormals
+  parameter logic                       EnableVectors    = 1'b1,
+  parameter int unsigned                NumPipeRegs      = 0,
+  parameter fpnew_pkg::pipe_config_t    PipeConfig       = fpnew_pkg::BEFORE,
+  parameter type                        TagType          = logic,
+  parameter int unsigned                DivSqrtUnits     = 1,
+  parameter fpnew_pkg::divsqrt_config_t DivSqrtConfig    = fpnew_pkg::PULP_DIVSQRT,
+  parameter fpnew_pkg::fmt_unsigned_t   DivSqrtPrecision = '{default: 0},
+  parameter fpnew_pkg::mul_config_t     MulConfig        = fpnew_pkg::INFERRED_MUL,
+  parameter int unsigned                NumAccumulators  = 0, // per FMA lane (ADDMUL)
   // Do not change
   localparam int unsigned NUM_OPERANDS = fpnew_pkg::num_operands(OpGroup),
+  localparam int unsigned ACC_ID_BITS  = fpnew_pkg::acc_id_bits(NumAccumulators),
   localparam int unsigned NUM_FORMATS  = fpnew_pkg::NUM_FP_FORMATS
 ) (
   input logic                                     clk_i,
@@ -42,6 +49,11 @@ module fpnew_opgroup_multifmt_slice #(
   input fpnew_pkg::int_format_e                   int_fmt_i,
   input logic                                     vectorial_op_i,
   input TagType                                   tag_i,
+  input logic [ACC_ID_BITS-1:0]                   acc_id_i,
+  input logic                                     acc_fwd_i,
+  input fpnew_pkg::mx_scales_t                    mx_scales_i,
+  input logic [fpnew_pkg::SR_SEED_BITS-1:0]       sr_seed_i,
+  input logic                                     sr_seed_load_i,
   // Input Handshake
   input  logic                                    in_valid_i,
   output logic                                    in_ready_o,
@@ -66,8 +78,17 @@ module fpnew_opgroup_multifmt_slice #(
   localparam int unsigned FMT_BITS =
       fpnew_pkg::maximum($clog2(NUM_FORMATS), $clog2(NUM_INT_FORMATS));
   localparam int unsigned AUX_BITS = FMT_BITS + 2; // also add vectorial and integer flags
+  // FMA lanes may share one subword-parallel multiplier, which keeps them in lock-step
+  localparam logic SHARED_MULTIPLIER = (OpGroup == fpnew_pkg::ADDMUL)
+                                       && (MulConfig == fpnew_pkg::SIMD_MUL);
+  // FMA lanes waiting for their accumulators must also stall together
+  localparam logic LOCKSTEP_LANES = SHARED_MULTIPLIER
+                                    || ((OpGroup == fpnew_pkg::ADDMUL) && (NumAccumulators > 0));
+  localparam int unsigned MUL_PRECISION = fpnew_pkg::max_man_bits(FpFmtConfig) + 1;
 
   logic [NUM_LANES-1:0] lane_in_ready, lane_out_valid; // Handshake signals for the lanes
+  logic [NUM_LANES-1:0] lane_fast_path; // Lanes agree on the DIVSQRT fast path
+  logic                 fast_path;
   logic                 vectorial_op;
   logic [FMT_BITS-1:0]  dst_fmt; // destination format to pass along with operation
   logic [AUX_BITS-1:0]  aux_data;
@@ -91,6 +112,11 @@ module fpnew_opgroup_multifmt_slice #(
   logic   [NUM_LANES-1:0][AUX_BITS-1:0] lane_aux; // only the first one is actually used
   logic   [NUM_LANES-1:0]               lane_busy; // dito
 
+  // Multiplicands and products of the lanes, left-aligned for the shared multiplier
+  logic                  [NUM_LANES-1:0][1:0][MUL_PRECISION-1:0] lane_mul_operands;
+  fpnew_pkg::fp_format_e [NUM_LANES-1:0]                         lane_mul_fmt; // first one used
+  logic                  [NUM_LANES-1:0][2*MUL_PRECISION-1:0]    lane_mul_products;
+
   logic                result_is_vector;
   logic [FMT_BITS-1:0] result_fmt;
   logic                result_fmt_is_int, result_is_cpk;
@@ -101,6 +127,7 @@ module fpnew_opgroup_multifmt_slice #(
   // -----------
   assign in_ready_o   = lane_in_ready[0]; // Upstream ready is given by first lane
   assign vectorial_op = vectorial_op_i & EnableVectors; // only do vectorial stuff if enabled
+  assign fast_path    = (& lane_fast_path); // lanes must stay in lock-step
 
   // Cast-and-Pack ops are encoded in operation and modifier
   assign dst_fmt_is_int = (OpGroup == fpnew_pkg::CONV) & (op_i == fpnew_pkg::F2I);
@@ -145,6 +172,7 @@ module fpnew_opgroup_multifmt_slice #(
     localparam fpnew_pkg::ifmt_logic_t ACTIVE_INT_FORMATS =
         fpnew_pkg::get_lane_int_formats(Width, FpFmtConfig, IntFmtConfig, LANE);
     localparam int unsigned MAX_WIDTH = fpnew_pkg::max_fp_width(ACTIVE_FORMATS);
+    localparam int unsigned LANE_PRECISION = fpnew_pkg::max_man_bits(ACTIVE_FORMATS) + 1;
 
     // Cast-specific parameters
     localparam fpnew_pkg::fmt_logic_t CONV_FORMATS =
@@ -153,22 +181,50 @@ module fpnew_opgroup_multifmt_slice #(
         fpnew_pkg::get_conv_lane_int_formats(Width, FpFmtConfig, IntFmtConfig, LANE);
     localparam int unsigned CONV_WIDTH = fpnew_pkg::max_fp_width(CONV_FORMATS);
 
+    // Dot-product-specific parameters, lanes without a destination format stay unused
+    localparam fpnew_pkg::fmt_logic_t DOTP_FORMATS =
+        fpnew_pkg::get_dotp_lane_formats(Width, FpFmtConfig, LANE);
+    localparam int unsigned DOTP_WIDTH = (| DOTP_FORMATS)
+                                         ? fpnew_pkg::max_fp_width(DOTP_FORMATS)
+                                         : MAX_WIDTH;
+
     // Lane parameters from Opgroup
     localparam fpnew_pkg::fmt_logic_t LANE_FORMATS = (OpGroup == fpnew_pkg::CONV)
-                                                     ? CONV_FORMATS : ACTIVE_FORMATS;
-    localparam int unsigned LANE_WIDTH = (OpGroup == fpnew_pkg::CONV) ? CONV_WIDTH : MAX_WIDTH;
+                                                     ? CONV_FORMATS
+                                                     : (OpGroup == fpnew_pkg::DOTP)
+                                                       ? DOTP_FORMATS
+                                                       : ACTIVE_FORMATS;
+    localparam int unsigned LANE_WIDTH = (OpGroup == fpnew_pkg::CONV)
+                                         ? CONV_WIDTH
+                                         : (OpGroup == fpnew_pkg::DOTP) ? DOTP_WIDTH : MAX_WIDTH;
 
     logic [LANE_WIDTH-1:0] local_result; // lane-local results
 
     // Generate instances only if needed, lane 0 always generated
-    if ((lane == 0) || EnableVectors) begin : active_lane
+    if (((lane == 0) || EnableVectors) && (| LANE_FORMATS)) begin : active_lane
       logic in_valid, out_valid, out_ready; // lane-local handshake
+      logic lane_used; // the lane holds an element of the operation
 
       logic [NUM_OPERANDS-1:0][LANE_WIDTH-1:0] local_operands;  // lane-local oprands
       logic [LANE_WIDTH-1:0]                   op_result;       // lane-local results
       fpnew_pkg::status_t                      op_status;
 
-      assign in_valid = in_valid_i & ((lane == 0) | vectorial_op); // upper lanes only for vectors
+      // Upper lanes only for vectors. Widening FMAs and dot products have fewer result lanes than
+      // source elements, lanes past the destination vector stay idle so they cannot raise flags.
+      if (OpGroup == fpnew_pkg::ADDMUL || OpGroup == fpnew_pkg::DOTP) begin : gen_fma_lane_used
+        assign lane_used = ((lane == 0) | vectorial_op)
+                           & (LANE < fpnew_pkg::num_lanes(Width, dst_fmt_i, 1'b1));
+      end else begin : gen_lane_used
+        assign lane_used = (lane == 0) | vectorial_op;
+      end
+
+      // Lanes in lock-step must hold the same operation in each stage. They all take every
+      // operation, unused lanes compute on zero operands whose results and flags are discarded.
+      if (LOCKSTEP_LANES) begin : gen_lockstep_valid
+        assign in_valid = in_valid_i;
+      end else begin : gen_lane_valid
+        assign in_valid = in_valid_i & lane_used;
+      end
 
       // Slice out the operands for this lane, upper bits are ignored in the unit
       always_comb begin : prepare_input
@@ -176,6 +232,23 @@ module fpnew_opgroup_multifmt_slice #(
           local_operands[i] = operands_i[i] >> LANE*fpnew_pkg::fp_width(src_fmt_i);
         end
 
+        // The FMA addend is in the destination format, which is wider for widening operations
+        if (OpGroup == fpnew_pkg::ADDMUL) begin
+          local_operands[2] = operands_i[2] >> LANE*fpnew_pkg::fp_width(dst_fmt_i);
+        end
+
+        // Dot products take pairs of elements, all operands are sliced by the destination format
+        if (OpGroup == fpnew_pkg::DOTP) begin
+          for (int unsigned i = 0; i < NUM_OPERANDS; i++) begin
+            local_operands[i] = operands_i[i] >> LANE*fpnew_pkg::fp_width(dst_fmt_i);
+          end
+        end
+
+        // Unused lanes in lock-step see zero operands to keep them from toggling
+        if (LOCKSTEP_LANES && !lane_used) begin
+          local_operands = '0;
+        end
+
         // override operand 0 for some conversions
         if (OpGroup == fpnew_pkg::CONV) begin
           // Source is an integer
@@ -198,12 +271,19 @@ module fpnew_opgroup_multifmt_slice #(
 
       // Instantiate the operation from the selected opgroup
       if (OpGroup == fpnew_pkg::ADDMUL) begin : lane_instance
+        logic [1:0][LANE_PRECISION-1:0] mul_operands;
+        logic [2*LANE_PRECISION-1:0]    mul_product;
+
         fpnew_fma_multi #(
-          .FpFmtConfig ( LANE_FORMATS         ),
-          .NumPipeRegs ( NumPipeRegs          ),
-          .PipeConfig  ( PipeConfig           ),
-          .TagType     ( TagType              ),
-          .AuxType     ( logic [AUX_BITS-1:0] )
+          .FpFmtConfig     ( LANE_FORMATS         ),
+          .FtzFmtConfig    ( FtzFmtConfig         ),
+          .NumPipeRegs     ( NumPipeRegs          ),
+          .PipeConfig      ( PipeConfig           ),
+          .MulConfig       ( MulConfig            ),
+          .NumAccumulators ( NumAccumulators      ),
+          .TagType         ( TagType              ),
+          .AuxType         ( logic [AUX_BITS-1:0] ),
+          .SrResetState    ( fpnew_pkg::sr_lane_seed(fpnew_pkg::SR_RESET_SEED, lane) )
         ) i_fpnew_fma_multi (
           .clk_i,
           .rst_ni,
@@ -216,6 +296,14 @@ module fpnew_opgroup_multifmt_slice #(
           .dst_fmt_i,
           .tag_i,
           .aux_i           ( aux_data            ),
+          .acc_id_i,
+          .acc_fwd_i,
+          .mx_scales_i,
+          .sr_seed_i       ( fpnew_pkg::sr_lane_seed(sr_seed_i, lane) ),
+          .sr_seed_load_i,
+          .mul_operands_o  ( mul_operands        ),
+          .mul_fmt_o       ( lane_mul_fmt[lane]  ),
+          .mul_product_i   ( mul_product         ),
           .in_valid_i      ( in_valid            ),
           .in_ready_o      ( lane_in_ready[lane] ),
           .flush_i,
@@ -229,21 +317,67 @@ module fpnew_opgroup_multifmt_slice #(
           .busy_o          ( lane_busy[lane]     )
         );
 
+        // Mantissae and products are left-aligned to the most precise format of the slice
+        for (genvar op = 0; op < 2; op++) begin : gen_mul_operands
+          assign lane_mul_operands[lane][op] = MUL_PRECISION'(mul_operands[op])
+                                               << (MUL_PRECISION - LANE_PRECISION);
+        end
+        assign mul_product = lane_mul_products[lane][2*MUL_PRECISION-1-:2*LANE_PRECISION];
+
       end else if (OpGroup == fpnew_pkg::DIVSQRT) begin : lane_instance
         fpnew_divsqrt_multi #(
+          .FpFmtConfig      ( LANE_FORMATS         ),
+          .NumPipeRegs      ( NumPipeRegs          ),
+          .PipeConfig       ( PipeConfig           ),
+          .TagType          ( TagType              ),
+          .AuxType          ( logic [AUX_BITS-1:0] ),
+          .NumUnits         ( DivSqrtUnits         ),
+          .DivSqrtConfig    ( DivSqrtConfig        ),
+          .ReducedPrecision ( DivSqrtPrecision     )
+        ) i_fpnew_divsqrt_multi (
+          .clk_i,
+          .rst_ni,
+          .operands_i      ( local_operands[1:0]  ), // 2 operands
+          .is_boxed_i      ( is_boxed_2op         ), // 2 operands
+          .rnd_mode_i,
+          .op_i,
+          .op_mod_i,
+          .dst_fmt_i,
+          .tag_i,
+          .aux_i           ( aux_data             ),
+          .fast_path_o     ( lane_fast_path[lane] ),
+          .fast_path_i     ( fast_path            ),
+          .in_valid_i      ( in_valid             ),
+          .in_ready_o      ( lane_in_ready[lane]  ),
+          .flush_i,
+          .result_o        ( op_result            ),
+          .status_o        ( op_status            ),
+          .extension_bit_o ( lane_ext_bit[lane]   ),
+          .tag_o           ( lane_tags[lane]      ),
+          .aux_o           ( lane_aux[lane]       ),
+          .out_valid_o     ( out_valid            ),
+          .out_ready_i     ( out_ready            ),
+          .busy_o          ( lane_busy[lane]      )
+        );
+      end else if (OpGroup == fpnew_pkg::NONCOMP) begin : lane_instance
+
+      end else if (OpGroup == fpnew_pkg::DOTP) begin : lane_instance
+        fpnew_sdotp_multi #(
           .FpFmtConfig ( LANE_FORMATS         ),
           .NumPipeRegs ( NumPipeRegs          ),
           .PipeConfig  ( PipeConfig           ),
           .TagType     ( TagType              ),
           .AuxType     ( logic [AUX_BITS-1:0] )
-        ) i_fpnew_divsqrt_multi (
+        ) i_fpnew_sdotp_multi (
           .clk_i,
           .rst_ni,
-          .operands_i      ( local_operands[1:0] ), // 2 operands
-          .is_boxed_i      ( is_boxed_2op        ), // 2 operands
+          .operands_i      ( local_operands          ),
+          .is_boxed_i      ( is_boxed_i[dst_fmt_i]   ), // boxed in the destination format
           .rnd_mode_i,
-          .op_i,
+          .op_mod_i,
+          .src_fmt_i,
           .dst_fmt_i,
+          .mx_scales_i,
           .tag_i,
           .aux_i           ( aux_data            ),
           .in_valid_i      ( in_valid            ),
@@ -258,16 +392,17 @@ module fpnew_opgroup_multifmt_slice #(
           .out_ready_i     ( out_ready           ),
           .busy_o          ( lane_busy[lane]     )
         );
-      end else if (OpGroup == fpnew_pkg::NONCOMP) begin : lane_instance
 
       end else if (OpGroup == fpnew_pkg::CONV) begin : lane_instance
         fpnew_cast_multi #(
           .FpFmtConfig  ( LANE_FORMATS         ),
           .IntFmtConfig ( CONV_INT_FORMATS     ),
+          .FtzFmtConfig ( FtzFmtConfig         ),
           .NumPipeRegs  ( NumPipeRegs          ),
           .PipeConfig   ( PipeConfig           ),
           .TagType      ( TagType              ),
-          .AuxType      ( logic [AUX_BITS-1:0] )
+          .AuxType      ( logic [AUX_BITS-1:0] ),
+          .SrResetState ( fpnew_pkg::sr_lane_seed(fpnew_pkg::SR_RESET_SEED, lane) )
         ) i_fpnew_cast_multi (
           .clk_i,
           .rst_ni,
@@ -281,6 +416,9 @@ module fpnew_opgroup_multifmt_slice #(
           .int_fmt_i,
           .tag_i,
           .aux_i           ( aux_data            ),
+          .mx_scales_i,
+          .sr_seed_i       ( fpnew_pkg::sr_lane_seed(sr_seed_i, lane) ),
+          .sr_seed_load_i,
           .in_valid_i      ( in_valid            ),
           .in_ready_o      ( lane_in_ready[lane] ),
           .flush_i,
@@ -295,8 +433,20 @@ module fpnew_opgroup_multifmt_slice #(
         );
       end // ADD OTHER OPTIONS HERE
 
-      // Handshakes are only done if the lane is actually used
-      assign out_ready            = out_ready_i & ((lane == 0) | result_is_vector);
+      // Only DIVSQRT lanes have a fast path
+      if (OpGroup != fpnew_pkg::DIVSQRT) begin : no_fast_path
+        assign lane_fast_path[lane] = 1'b1;
+      end
+
+      // Only FMA lanes use the shared multiplier
+      if (OpGroup != fpnew_pkg::ADDMUL) begin : no_mul_operands
+        assign lane_mul_operands[lane] = '0;
+        assign lane_mul_fmt[lane]      = fpnew_pkg::fp_format_e'(0);
+      end
+
+      // Handshakes are only done if the lane is actually used, lanes in lock-step always pop
+      assign out_ready            = out_ready_i
+                                    & ((lane == 0) | result_is_vector | LOCKSTEP_LANES);
       assign lane_out_valid[lane] = out_valid & ((lane == 0) | result_is_vector);
 
       // Properly NaN-box or sign-extend the slice result if not in use
@@ -305,19 +455,22 @@ module fpnew_opgroup_multifmt_slice #(
 
     // Otherwise generate constant sign-extension
     end else begin : inactive_lane
-      assign lane_out_valid[lane] = 1'b0; // unused lane
-      assign lane_in_ready[lane]  = 1'b0; // unused lane
-      assign local_result         = '{default: lane_ext_bit[0]}; // sign-extend/nan box
-      assign lane_status[lane]    = '0;
-      assign lane_busy[lane]      = 1'b0;
+      assign lane_out_valid[lane]    = 1'b0; // unused lane
+      assign lane_in_ready[lane]     = 1'b0; // unused lane
+      assign lane_fast_path[lane]    = 1'b1; // unused lane
+      assign local_result            = '{default: lane_ext_bit[0]}; // sign-extend/nan box
+      assign lane_status[lane]       = '0;
+      assign lane_busy[lane]         = 1'b0;
+      assign lane_mul_operands[lane] = '0; // unused lane
+      assign lane_mul_fmt[lane]      = fpnew_pkg::fp_format_e'(0);
     end
 
     // Generate result packing depending on float format
     for (genvar fmt = 0; fmt < NUM_FORMATS; fmt++) begin : pack_fp_result
       // Set up some constants
       localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
-      // only for active formats within the lane
-      if (ACTIVE_FORMATS[fmt]) begin
+      // only for active formats within the lane (dot product lanes only hold their results)
+      if (ACTIVE_FORMATS[fmt] && (FP_WIDTH <= LANE_WIDTH)) begin
         assign fmt_slice_result[fmt][(LANE+1)*FP_WIDTH-1:LANE*FP_WIDTH] =
             local_result[FP_WIDTH-1:0];
       end else if ((LANE+1)*FP_WIDTH <= Width) begin
@@ -346,6 +499,21 @@ module fpnew_opgroup_multifmt_slice #(
     end
   end
 
+  // Lanes of FMA slices share one multiplier partitioned by the format of the operation
+  if (SHARED_MULTIPLIER) begin : gen_shared_multiplier
+    fpnew_simd_multiplier #(
+      .Width         ( Width         ),
+      .FpFmtConfig   ( FpFmtConfig   ),
+      .EnableVectors ( EnableVectors )
+    ) i_fpnew_simd_multiplier (
+      .operands_i ( lane_mul_operands ),
+      .fmt_i      ( lane_mul_fmt[0]   ), // all lanes hold the same operation
+      .products_o ( lane_mul_products )
+    );
+  end else begin : no_shared_multiplier
+    assign lane_mul_products = '0;
+  end
+
   // Extend slice result if needed
   for (genvar fmt = 0; fmt < NUM_FORMATS; fmt++) begin : extend_fp_result
     // Set up some constants
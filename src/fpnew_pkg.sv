@@ -25,6 +25,9 @@ package fpnew_pkg;
   // | FP16       | IEEE binary16    | 16 bit | 5        | 10
   // | FP8        | binary8          |  8 bit | 5        | 2
   // | FP16ALT    | binary16alt      | 16 bit | 8        | 7
+  // | FP8E4M3    | OCP FP8 E4M3     |  8 bit | 4        | 3
+  // OCP FP8 E5M2 is the encoding of FP8 (alias FP8E5M2). E4M3 has no infinities, its all-ones
+  // exponent holds normal values and only the all-ones exponent and mantissa encode NaN.
   // *NOTE:* Add new formats only at the end of the enumeration for backwards compatibilty!
 
   // Encoding for a format
@@ -33,7 +36,7 @@ package fpnew_pkg;
     int unsigned man_bits;
   } fp_encoding_t;
 
-  localparam int unsigned NUM_FP_FORMATS = 5; // change me to add formats
+  localparam int unsigned NUM_FP_FORMATS = 6; // change me to add formats
   localparam int unsigned FP_FORMAT_BITS = $clog2(NUM_FP_FORMATS);
 
   // FP formats
@@ -42,24 +45,29 @@ package fpnew_pkg;
     FP64    = 'd1,
     FP16    = 'd2,
     FP8     = 'd3,
-    FP16ALT = 'd4
+    FP16ALT = 'd4,
+    FP8E4M3 = 'd5
     // add new formats here
   } fp_format_e;
 
+  localparam fp_format_e FP8E5M2 = FP8; // OCP FP8 E5M2 shares the encoding of binary8
+
   // Encodings for supported FP formats
   localparam fp_encoding_t [0:NUM_FP_FORMATS-1] FP_ENCODINGS  = '{
     '{8,  23}, // IEEE binary32 (single)
     '{11, 52}, // IEEE binary64 (double)
     '{5,  10}, // IEEE binary16 (half)
     '{5,  2},  // custom binary8
-    '{8,  7}   // custom binary16alt
+    '{8,  7},  // custom binary16alt
+    '{4,  3}   // OCP FP8 E4M3
     // add new formats here
   };
 
   typedef logic [0:NUM_FP_FORMATS-1]       fmt_logic_t;    // Logic indexed by FP format (for masks)
   typedef logic [0:NUM_FP_FORMATS-1][31:0] fmt_unsigned_t; // Unsigned indexed by FP format
 
-  localparam fmt_logic_t CPK_FORMATS = 5'b11000; // FP32 and FP64 can provide CPK only
+  localparam fmt_logic_t CPK_FORMATS    = 6'b110000; // FP32 and FP64 can provide CPK only
+  localparam fmt_logic_t NO_INF_FORMATS = 6'b000001; // E4M3 has no infinities and a single NaN
 
   // ---------
   // INT TYPES
@@ -107,20 +115,25 @@ package fpnew_pkg;
   // --------------
   // FP OPERATIONS
   // --------------
-  localparam int unsigned NUM_OPGROUPS = 4;
+  localparam int unsigned NUM_OPGROUPS = 5;
 
   // Each FP operation belongs to an operation group
-  typedef enum logic [1:0] {
-    ADDMUL, DIVSQRT, NONCOMP, CONV
+  typedef enum logic [2:0] {
+    ADDMUL, DIVSQRT, NONCOMP, CONV, DOTP
   } opgroup_e;
 
-  localparam int unsigned OP_BITS = 4;
+  localparam int unsigned OP_BITS = 5;
 
   typedef enum logic [OP_BITS-1:0] {
     FMADD, FNMSUB, ADD, MUL,     // ADDMUL operation group
     DIV, SQRT,                   // DIVSQRT operation group
     SGNJ, MINMAX, CMP, CLASSIFY, // NONCOMP operation group
-    F2F, F2I, I2F, CPKAB, CPKCD  // CONV operation group
+    F2F, F2I, I2F, CPKAB, CPKCD, // CONV operation group
+    RECE, RSQRTE,                // NONCOMP operation group (estimates)
+    SDOTP,                       // DOTP operation group
+    MXFMADD, MXFNMSUB, MXMUL,    // ADDMUL operation group (MX block scaled)
+    MXSDOTP,                     // DOTP operation group (MX block scaled)
+    MXF2F                        // CONV operation group (MX block scaled)
   } operation_e;
 
   // -------------------
@@ -133,9 +146,29 @@ package fpnew_pkg;
     RDN = 3'b010,
     RUP = 3'b011,
     RMM = 3'b100,
+    ROD = 3'b101, // Round to odd, not part of the RISC-V FP-SPEC
+    RSR = 3'b110, // Stochastic rounding, not part of the RISC-V FP-SPEC
     DYN = 3'b111
   } roundmode_e;
 
+  // Stochastic rounding resolves SR_BITS bits below the rounding point with random bits from
+  // per-lane LFSRs, which are seeded with SR_SEED_BITS bits
+  localparam int unsigned SR_BITS      = 16;
+  localparam int unsigned SR_SEED_BITS = 32;
+  // Seed the LFSRs start from after reset, mixed with the lane index like loaded seeds
+  localparam logic [SR_SEED_BITS-1:0] SR_RESET_SEED = 32'h0000_0001;
+
+  // MX block scaling multiplies products and converted values by shared E8M0 block scales of
+  // MX_SCALE_BITS bits, each worth 2**(scale-MX_SCALE_BIAS). The all-ones scale is NaN.
+  localparam int unsigned MX_SCALE_BITS = 8;
+  localparam int unsigned MX_SCALE_BIAS = 127;
+
+  typedef logic [1:0][MX_SCALE_BITS-1:0] mx_scales_t; // block scales of operands 0 and 1
+
+  localparam mx_scales_t MX_NO_SCALE = '{default: MX_SCALE_BITS'(MX_SCALE_BIAS)}; // 2**0 each
+
+  // Only the MX operations (see is_mx_op) read the block scales, all other operations are unscaled.
+
   // Status flags
   typedef struct packed {
     logic NV; // Invalid
@@ -189,6 +222,40 @@ package fpnew_pkg;
     MERGED    // arithmetic units are contained within a merged unit holding multiple formats
   } unit_type_t;
 
+  // Results contending for an output can be arbitrated fairly or by the age of their operation
+  typedef enum logic {
+    ROUND_ROBIN, // results are granted in round-robin fashion among the contending units
+    OLDEST_FIRST // the result of the operation that was issued first is granted
+  } arb_config_t;
+
+  // Backpressure can reach the inputs combinationally or through registered credits
+  typedef enum logic {
+    COMBINATIONAL, // input ready depends combinationally on the output ready through all stages
+    REGISTERED     // input ready is derived from registered credits and input buffer levels
+  } ready_config_t;
+
+  // Division and square root are computed by the external unit, by the in-tree digit recurrence or
+  // by Newton-Raphson iterations on the FMA units
+  typedef enum logic [1:0] {
+    PULP_DIVSQRT,  // external fpu_div_sqrt_mvp unit in merged slices, radix-2 recurrence otherwise
+    RADIX2,        // in-tree radix-2 digit recurrence computing one result bit per cycle
+    RADIX2_X2,     // in-tree radix-2 digit recurrence with two steps (result bits) per cycle
+    NEWTON_RAPHSON // scalar iterations issued to the ADDMUL operation group in fpnew_top
+  } divsqrt_config_t;
+
+  // Additions are computed on the FMA units or on dedicated dual-path adders
+  typedef enum logic {
+    FMA_ADD,      // ADD operations use the FMA datapath with the multiplicand set to 1.0
+    DUAL_PATH_ADD // ADD operations use near/far-path adders next to PARALLEL FMA slices
+  } add_config_t;
+
+  // Mantissa products in the FMA units are left to synthesis or built from an in-tree multiplier
+  typedef enum logic [1:0] {
+    INFERRED_MUL, // the product uses the '*' operator, its architecture is chosen by synthesis
+    BOOTH_MUL,    // radix-4 Booth multiplier with a 3:2 compressor tree and carry-save output
+    SIMD_MUL      // one subword-parallel multiplier shared by the lanes of MERGED slices
+  } mul_config_t;
+
   // Array of unit types indexed by format
   typedef unit_type_t [0:NUM_FP_FORMATS-1] fmt_unit_types_t;
 
@@ -196,6 +263,8 @@ package fpnew_pkg;
   typedef fmt_unit_types_t [0:NUM_OPGROUPS-1] opgrp_fmt_unit_types_t;
   // same with unsigned
   typedef fmt_unsigned_t [0:NUM_OPGROUPS-1] opgrp_fmt_unsigned_t;
+  // Unsigned indexed by opgroup
+  typedef logic [0:NUM_OPGROUPS-1][31:0] opgrp_unsigned_t;
 
   // FPU configuration: features
   typedef struct packed {
@@ -204,54 +273,61 @@ package fpnew_pkg;
     logic        EnableNanBox;
     fmt_logic_t  FpFmtMask;
     ifmt_logic_t IntFmtMask;
+    fmt_logic_t  FtzFmtMask; // formats flushing subnormals to zero (FTZ/DAZ)
   } fpu_features_t;
 
   localparam fpu_features_t RV64D = '{
     Width:         64,
     EnableVectors: 1'b0,
     EnableNanBox:  1'b1,
-    FpFmtMask:     5'b11000,
-    IntFmtMask:    4'b0011
+    FpFmtMask:     6'b110000,
+    IntFmtMask:    4'b0011,
+    FtzFmtMask:    6'b000000
   };
 
   localparam fpu_features_t RV32D = '{
     Width:         64,
     EnableVectors: 1'b1,
     EnableNanBox:  1'b1,
-    FpFmtMask:     5'b11000,
-    IntFmtMask:    4'b0010
+    FpFmtMask:     6'b110000,
+    IntFmtMask:    4'b0010,
+    FtzFmtMask:    6'b000000
   };
 
   localparam fpu_features_t RV32F = '{
     Width:         32,
     EnableVectors: 1'b0,
     EnableNanBox:  1'b1,
-    FpFmtMask:     5'b10000,
-    IntFmtMask:    4'b0010
+    FpFmtMask:     6'b100000,
+    IntFmtMask:    4'b0010,
+    FtzFmtMask:    6'b000000
   };
 
   localparam fpu_features_t RV64D_Xsflt = '{
     Width:         64,
     EnableVectors: 1'b1,
     EnableNanBox:  1'b1,
-    FpFmtMask:     5'b11111,
-    IntFmtMask:    4'b1111
+    FpFmtMask:     6'b111110,
+    IntFmtMask:    4'b1111,
+    FtzFmtMask:    6'b000000
   };
 
   localparam fpu_features_t RV32F_Xsflt = '{
     Width:         32,
     EnableVectors: 1'b1,
     EnableNanBox:  1'b1,
-    FpFmtMask:     5'b10111,
-    IntFmtMask:    4'b1110
+    FpFmtMask:     6'b101110,
+    IntFmtMask:    4'b1110,
+    FtzFmtMask:    6'b000000
   };
 
   localparam fpu_features_t RV32F_Xf16alt_Xfvec = '{
     Width:         32,
     EnableVectors: 1'b1,
     EnableNanBox:  1'b1,
-    FpFmtMask:     5'b10001,
-    IntFmtMask:    4'b0110
+    FpFmtMask:     6'b100010,
+    IntFmtMask:    4'b0110,
+    FtzFmtMask:    6'b000000
   };
 
 
@@ -260,24 +336,53 @@ package fpnew_pkg;
     opgrp_fmt_unsigned_t   PipeRegs;
     opgrp_fmt_unit_types_t UnitTypes;
     pipe_config_t          PipeConfig;
+    arb_config_t           ArbConfig;
+    opgrp_unsigned_t       ResultFifoDepth;
+    ready_config_t         ReadyConfig;
+    int unsigned           DivSqrtUnits;
+    divsqrt_config_t       DivSqrtConfig;
+    fmt_unsigned_t         DivSqrtPrecision;
+    add_config_t           AddConfig;
+    fmt_unsigned_t         AddPipeRegs;
+    mul_config_t           MulConfig;
   } fpu_implementation_t;
 
   localparam fpu_implementation_t DEFAULT_NOREGS = '{
-    PipeRegs:   '{default: 0},
-    UnitTypes:  '{'{default: PARALLEL}, // ADDMUL
-                  '{default: MERGED},   // DIVSQRT
-                  '{default: PARALLEL}, // NONCOMP
-                  '{default: MERGED}},  // CONV
-    PipeConfig: BEFORE
+    PipeRegs:         '{default: 0},
+    UnitTypes:        '{'{default: PARALLEL},  // ADDMUL
+                        '{default: MERGED},    // DIVSQRT
+                        '{default: PARALLEL},  // NONCOMP
+                        '{default: MERGED},    // CONV
+                        '{default: DISABLED}}, // DOTP
+    PipeConfig:       BEFORE,
+    ArbConfig:        ROUND_ROBIN,
+    ResultFifoDepth:  '{default: 0},
+    ReadyConfig:      COMBINATIONAL,
+    DivSqrtUnits:     1,
+    DivSqrtConfig:    PULP_DIVSQRT,
+    DivSqrtPrecision: '{default: 0},
+    AddConfig:        FMA_ADD,
+    AddPipeRegs:      '{default: 0},
+    MulConfig:        INFERRED_MUL
   };
 
   localparam fpu_implementation_t DEFAULT_SNITCH = '{
-    PipeRegs:   '{default: 1},
-    UnitTypes:  '{'{default: PARALLEL}, // ADDMUL
-                  '{default: DISABLED}, // DIVSQRT
-                  '{default: PARALLEL}, // NONCOMP
-                  '{default: MERGED}},  // CONV
-    PipeConfig: BEFORE
+    PipeRegs:         '{default: 1},
+    UnitTypes:        '{'{default: PARALLEL},  // ADDMUL
+                        '{default: DISABLED},  // DIVSQRT
+                        '{default: PARALLEL},  // NONCOMP
+                        '{default: MERGED},    // CONV
+                        '{default: DISABLED}}, // DOTP
+    PipeConfig:       BEFORE,
+    ArbConfig:        ROUND_ROBIN,
+    ResultFifoDepth:  '{default: 0},
+    ReadyConfig:      COMBINATIONAL,
+    DivSqrtUnits:     1,
+    DivSqrtConfig:    PULP_DIVSQRT,
+    DivSqrtPrecision: '{default: 0},
+    AddConfig:        FMA_ADD,
+    AddPipeRegs:      '{default: 0},
+    MulConfig:        INFERRED_MUL
   };
 
   // -----------------------
@@ -296,6 +401,17 @@ package fpnew_pkg;
     return (a > b) ? a : b;
   endfunction
 
+  // Returns the width of an accumulator ID, ID 0 selecting no accumulator
+  function automatic int unsigned acc_id_bits(int unsigned num_acc);
+    return unsigned'(maximum($clog2(num_acc + 1), 1));
+  endfunction
+
+  // Returns the LFSR seed of a lane for stochastic rounding, such that all lanes draw differently
+  function automatic logic [SR_SEED_BITS-1:0] sr_lane_seed(logic [SR_SEED_BITS-1:0] seed,
+                                                           int unsigned lane);
+    return seed ^ (SR_SEED_BITS'(lane) * 32'h9E37_79B9);
+  endfunction
+
   // -------------------------------------------
   // Helper functions for FP formats and values
   // -------------------------------------------
@@ -332,11 +448,35 @@ package fpnew_pkg;
     return FP_ENCODINGS[fmt].man_bits;
   endfunction
 
+  // Returns the number of mantissa bits of the most precise format present
+  function automatic int unsigned max_man_bits(fmt_logic_t cfg);
+    automatic int unsigned res = 0;
+    for (int unsigned i = 0; i < NUM_FP_FORMATS; i++)
+      if (cfg[i])
+        res = unsigned'(maximum(res, man_bits(fp_format_e'(i))));
+    return res;
+  endfunction
+
   // Returns the bias value for a given format (as per IEEE 754-2008)
   function automatic int unsigned bias(fp_format_e fmt);
     return unsigned'(2**(FP_ENCODINGS[fmt].exp_bits-1)-1); // symmetrical bias
   endfunction
 
+  // Returns the largest biased exponent of finite values of a format
+  function automatic int unsigned max_exponent(fp_format_e fmt);
+    return NO_INF_FORMATS[fmt] ? 2**exp_bits(fmt) - 1 : 2**exp_bits(fmt) - 2;
+  endfunction
+
+  // Returns the mantissa of the largest finite value of a format
+  function automatic int unsigned max_mantissa(fp_format_e fmt);
+    return NO_INF_FORMATS[fmt] ? 2**man_bits(fmt) - 2 : 2**man_bits(fmt) - 1;
+  endfunction
+
+  // Returns the mantissa of the canonical quiet NaN of a format
+  function automatic int unsigned qnan_mantissa(fp_format_e fmt);
+    return NO_INF_FORMATS[fmt] ? 2**man_bits(fmt) - 1 : 2**(man_bits(fmt) - 1);
+  endfunction
+
   function automatic fp_encoding_t super_format(fmt_logic_t cfg);
     automatic fp_encoding_t res;
     res = '0;
@@ -348,6 +488,38 @@ package fpnew_pkg;
     return res;
   endfunction
 
+  // ----------------------------------------
+  // Helper functions for reciprocal tables
+  // ----------------------------------------
+  // Returns the number of mantissa bits provided by the estimate tables of a format
+  function automatic int unsigned est_bits(fp_format_e fmt);
+    return unsigned'(minimum(man_bits(fmt), 7));
+  endfunction
+
+  // Reciprocal table entry for operand mantissas starting with idx: the mantissa of 2/x at the
+  // center of the range of 2/x, with the given number of index and result bits
+  function automatic int unsigned rece_entry(int unsigned idx, int unsigned bits);
+    automatic longint unsigned lo, num, den, sig;
+    lo  = 2**bits + idx;
+    num = 2**(2*bits) * (2 * lo + 1);
+    den = lo * (lo + 1);
+    sig = (2 * num + den) / (2 * den); // round to nearest
+    return (sig >= 2**(bits+1)) ? 2**bits - 1 : unsigned'(int'(sig - 2**bits));
+  endfunction
+
+  // Reciprocal square root table entry: the mantissa of 2/sqrt(y), rounded to nearest, where y is
+  // the center of the operand range. The index MSB is the exponent LSB: even exponents scale the
+  // operand by 2 so that y lies in [1, 4).
+  function automatic int unsigned rsqrte_entry(int unsigned idx, int unsigned bits);
+    automatic longint unsigned lo, num, sig;
+    lo  = 2**(bits-1) + idx % 2**(bits-1);
+    num = (2 * lo + 1) * ((idx >= 2**(bits-1)) ? 1 : 2); // y = num / 2**bits
+    // Largest sig with sig - 0.5 <= 2**bits * 2/sqrt(y)
+    sig = 2**(bits+1);
+    while ((2 * sig - 1)**2 * num > 2**(3*bits+4)) sig--;
+    return (sig >= 2**(bits+1)) ? 2**bits - 1 : unsigned'(int'(sig - 2**bits));
+  endfunction
+
   // -------------------------------------------
   // Helper functions for INT formats and values
   // -------------------------------------------
@@ -367,13 +539,34 @@ package fpnew_pkg;
   function automatic opgroup_e get_opgroup(operation_e op);
     unique case (op)
       FMADD, FNMSUB, ADD, MUL:     return ADDMUL;
+      MXFMADD, MXFNMSUB, MXMUL:    return ADDMUL;
       DIV, SQRT:                   return DIVSQRT;
       SGNJ, MINMAX, CMP, CLASSIFY: return NONCOMP;
+      RECE, RSQRTE:                return NONCOMP;
       F2F, F2I, I2F, CPKAB, CPKCD: return CONV;
+      SDOTP, MXSDOTP:              return DOTP;
+      MXF2F:                       return CONV;
       default:                     return NONCOMP;
     endcase
   endfunction
 
+  // Returns whether the operation applies the MX block scales
+  function automatic logic is_mx_op(operation_e op);
+    return op inside {MXFMADD, MXFNMSUB, MXMUL, MXSDOTP, MXF2F};
+  endfunction
+
+  // Returns the operation the units carry out for an MX block scaled operation
+  function automatic operation_e mx_base_op(operation_e op);
+    unique case (op)
+      MXFMADD:  return FMADD;
+      MXFNMSUB: return FNMSUB;
+      MXMUL:    return MUL;
+      MXSDOTP:  return SDOTP;
+      MXF2F:    return F2F;
+      default:  return op;
+    endcase
+  endfunction
+
   // Returns the number of operands by operation group
   function automatic int unsigned num_operands(opgroup_e grp);
     unique case (grp)
@@ -381,6 +574,7 @@ package fpnew_pkg;
       DIVSQRT: return 2;
       NONCOMP: return 2;
       CONV:    return 3; // vectorial casts use 3 operands
+      DOTP:    return 3;
       default: return 0;
     endcase
   endfunction
@@ -454,6 +648,71 @@ package fpnew_pkg;
     return res;
   endfunction
 
+  // Returns a mask of active FP formats that fmt can hold exactly (widening FMA multiplicands)
+  function automatic fmt_logic_t get_widening_formats(fmt_logic_t cfg, fp_format_e fmt);
+    automatic fmt_logic_t res;
+    for (int unsigned i = 0; i < NUM_FP_FORMATS; i++)
+      res[i] = cfg[i] && (fp_format_e'(i) != fmt) &&
+               (exp_bits(fp_format_e'(i)) <= exp_bits(fmt)) &&
+               (man_bits(fp_format_e'(i)) <= man_bits(fmt));
+    return res;
+  endfunction
+
+  // Returns a mask of active FP formats that can accumulate dot products of half-width elements
+  function automatic fmt_logic_t get_dotp_dst_formats(fmt_logic_t cfg);
+    automatic fmt_logic_t res = '0;
+    for (int unsigned dst = 0; dst < NUM_FP_FORMATS; dst++)
+      for (int unsigned src = 0; src < NUM_FP_FORMATS; src++)
+        if (cfg[dst] && cfg[src] && (fp_width(fp_format_e'(dst)) <= 32) &&
+            (fp_width(fp_format_e'(dst)) == 2 * fp_width(fp_format_e'(src))))
+          res[dst] = 1'b1;
+    return res;
+  endfunction
+
+  // Returns a mask of active FP formats that are the elements of dot products accumulating into dst
+  function automatic fmt_logic_t get_dotp_src_formats(fmt_logic_t cfg, fmt_logic_t dst);
+    automatic fmt_logic_t res = '0;
+    for (int unsigned src = 0; src < NUM_FP_FORMATS; src++)
+      for (int unsigned fmt = 0; fmt < NUM_FP_FORMATS; fmt++)
+        if (cfg[src] && dst[fmt] &&
+            (fp_width(fp_format_e'(fmt)) == 2 * fp_width(fp_format_e'(src))))
+          res[src] = 1'b1;
+    return res;
+  endfunction
+
+  // Returns a mask of FP formats used in lane lane_no of a multiformat dot product slice: the
+  // destination formats present in the lane and their element formats
+  function automatic fmt_logic_t get_dotp_lane_formats(int unsigned width,
+                                                       fmt_logic_t cfg,
+                                                       int unsigned lane_no);
+    automatic fmt_logic_t dst;
+    dst = get_dotp_dst_formats(cfg) & get_lane_formats(width, cfg, lane_no);
+    return dst | get_dotp_src_formats(cfg, dst);
+  endfunction
+
+  // Returns a mask of the active FP formats operations of the given group are issued to. Division
+  // and square root are not available for formats without infinities.
+  function automatic fmt_logic_t get_opgroup_formats(opgroup_e opgroup, fmt_logic_t cfg);
+    unique case (opgroup)
+      DIVSQRT: return cfg & ~NO_INF_FORMATS;
+      DOTP:    return get_dotp_dst_formats(cfg);
+      default: return cfg;
+    endcase
+  endfunction
+
+  // Returns a mask of active FP formats with dual-path adders next to their PARALLEL FMA slices
+  function automatic fmt_logic_t get_add_formats(add_config_t add_cfg,
+                                                 fmt_unit_types_t types,
+                                                 fmt_logic_t cfg,
+                                                 fmt_logic_t ftz);
+    automatic fmt_logic_t res;
+    for (int unsigned i = 0; i < NUM_FP_FORMATS; i++)
+      res[i] = cfg[i] && (add_cfg == DUAL_PATH_ADD) && (types[i] == PARALLEL) &&
+               !NO_INF_FORMATS[i] && // additions without infinities stay on the FMA
+               !ftz[i];              // the adders don't flush subnormals
+    return res;
+  endfunction
+
   // Return whether any active format is set as MERGED
   function automatic logic any_enabled_multi(fmt_unit_types_t types, fmt_logic_t cfg);
     for (int unsigned i = 0; i < NUM_FP_FORMATS; i++)
@@ -14,7 +14,10 @@
 // Author: Stefan Mach <smach@iis.ee.ethz.ch>
 
 module fpnew_rounding #(
-  parameter int unsigned AbsWidth=2 // Width of the abolute value, without sign bit
+  parameter int unsigned AbsWidth=2, // Width of the abolute value, without sign bit
+  parameter int unsigned FracWidth=1, // Width of the fraction below the rounding point
+  // Do not change
+  localparam int unsigned SR_BITS = fpnew_pkg::SR_BITS
 ) (
   // Input value
   input logic [AbsWidth-1:0]   abs_value_i,             // absolute value without sign
@@ -23,6 +26,9 @@ module fpnew_rounding #(
   input logic [1:0]            round_sticky_bits_i,     // round and sticky bits {RS}
   input fpnew_pkg::roundmode_e rnd_mode_i,
   input logic                  effective_subtraction_i, // sign of inputs affects rounding of zeroes
+  // Stochastic rounding
+  input logic [FracWidth-1:0]  fraction_i,              // bits below the rounding point, MSB is R
+  input logic [SR_BITS-1:0]    random_i,                // random value added to the fraction
   // Output value
   output logic [AbsWidth-1:0]  abs_rounded_o,           // absolute value without sign
   output logic                 sign_o,
@@ -32,6 +38,21 @@ module fpnew_rounding #(
 
   logic round_up; // Rounding decision
 
+  // Stochastic rounding adds the random value to the leading bits of the fraction, the remaining
+  // bits are collapsed into its LSB. The carry into the ulp rounds up with a probability
+  // proportional to the fraction, exact values are never rounded.
+  logic [SR_BITS-1:0] sr_fraction;
+  logic [SR_BITS:0]   sr_sum; // with the carry into the ulp
+
+  if (FracWidth > SR_BITS) begin : gen_sr_sticky
+    assign sr_fraction = {fraction_i[FracWidth-1-:SR_BITS-1],
+                          (| fraction_i[FracWidth-SR_BITS:0])};
+  end else begin : gen_sr_padding
+    assign sr_fraction = SR_BITS'(fraction_i) << (SR_BITS - FracWidth);
+  end
+
+  assign sr_sum = sr_fraction + random_i;
+
   // Take the rounding decision according to RISC-V spec
   // RoundMode | Mnemonic | Meaning
   // :--------:|:--------:|:-------
@@ -40,6 +61,8 @@ module fpnew_rounding #(
   //    010    |   RDN    | Round Down (towards -\infty)
   //    011    |   RUP    | Round Up (towards \infty)
   //    100    |   RMM    | Round to Nearest, ties to Max Magnitude
+  //    101    |   ROD    | Round to Odd (set the LSB of inexact results)
+  //    110    |   RSR    | Round up with probability given by the fraction (stochastic rounding)
   //  others   |          | *invalid*
   always_comb begin : rounding_decision
     unique case (rnd_mode_i)
@@ -55,6 +78,8 @@ module fpnew_rounding #(
       fpnew_pkg::RDN: round_up = (| round_sticky_bits_i) ? sign_i  : 1'b0; // to 0 if +, away if -
       fpnew_pkg::RUP: round_up = (| round_sticky_bits_i) ? ~sign_i : 1'b0; // to 0 if -, away if +
       fpnew_pkg::RMM: round_up = round_sticky_bits_i[1]; // round down if < ulp/2 away, else up
+      fpnew_pkg::ROD: round_up = ~abs_value_i[0] & (| round_sticky_bits_i); // inexact to odd
+      fpnew_pkg::RSR: round_up = sr_sum[SR_BITS]; // the random value carried into the ulp
       default: round_up = fpnew_pkg::DONT_CARE; // propagate x
     endcase
   end
@@ -0,0 +1,949 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License. You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+//
+// SPDX-License-Identifier: SHL-0.51
+
+// Author: agent <agent@local>
+
+`include "common_cells/registers.svh"
+
+// Expanding sum of dot products: a[0]*b[0] + a[1]*b[1] + c with a single rounding. The elements of
+// the vectors a and b are in src_fmt_i and packed into operands 0 and 1, the addend c (operand 2)
+// and the result are in dst_fmt_i, which is twice as wide as src_fmt_i. The products are scaled by
+// the MX block scales of a and b.
+module fpnew_sdotp_multi #(
+  parameter fpnew_pkg::fmt_logic_t   FpFmtConfig = '1,
+  parameter int unsigned             NumPipeRegs = 0,
+  parameter fpnew_pkg::pipe_config_t PipeConfig  = fpnew_pkg::BEFORE,
+  parameter type                     TagType     = logic,
+  parameter type                     AuxType     = logic,
+  // Do not change
+  localparam fpnew_pkg::fmt_logic_t DST_FORMATS = fpnew_pkg::get_dotp_dst_formats(FpFmtConfig),
+  localparam int unsigned           WIDTH       = fpnew_pkg::max_fp_width(DST_FORMATS),
+  localparam int unsigned           NUM_FORMATS = fpnew_pkg::NUM_FP_FORMATS
+) (
+  input  logic                  clk_i,
+  input  logic                  rst_ni,
+  // Input signals
+  input  logic [2:0][WIDTH-1:0] operands_i, // 3 operands
+  input  logic [2:0]            is_boxed_i, // 3 operands, boxed in the destination format
+  input  fpnew_pkg::roundmode_e rnd_mode_i,
+  input  logic                  op_mod_i,
+  input  fpnew_pkg::fp_format_e src_fmt_i, // format of the vector elements
+  input  fpnew_pkg::fp_format_e dst_fmt_i, // format of the addend and result
+  input  fpnew_pkg::mx_scales_t mx_scales_i, // MX block scales of the vectors a and b
+  input  TagType                tag_i,
+  input  AuxType                aux_i,
+  // Input Handshake
+  input  logic                  in_valid_i,
+  output logic                  in_ready_o,
+  input  logic                  flush_i,
+  // Output signals
+  output logic [WIDTH-1:0]      result_o,
+  output fpnew_pkg::status_t    status_o,
+  output logic                  extension_bit_o,
+  output TagType                tag_o,
+  output AuxType                aux_o,
+  // Output handshake
+  output logic                  out_valid_o,
+  input  logic                  out_ready_i,
+  // Indication of valid data in flight
+  output logic                  busy_o
+);
+
+  // ----------
+  // Constants
+  // ----------
+  localparam fpnew_pkg::fmt_logic_t SRC_FORMATS =
+      fpnew_pkg::get_dotp_src_formats(FpFmtConfig, DST_FORMATS);
+  // The super-formats that can hold all element and destination formats
+  localparam fpnew_pkg::fp_encoding_t SRC_FORMAT   = fpnew_pkg::super_format(SRC_FORMATS);
+  localparam fpnew_pkg::fp_encoding_t SUPER_FORMAT = fpnew_pkg::super_format(DST_FORMATS);
+
+  localparam int unsigned SRC_EXP_BITS   = SRC_FORMAT.exp_bits;
+  localparam int unsigned SRC_MAN_BITS   = SRC_FORMAT.man_bits;
+  localparam int unsigned SUPER_EXP_BITS = SUPER_FORMAT.exp_bits;
+  localparam int unsigned SUPER_MAN_BITS = SUPER_FORMAT.man_bits;
+
+  // Precision bits 'p' include the implicit bit
+  localparam int unsigned SRC_PRECISION  = SRC_MAN_BITS + 1;
+  localparam int unsigned PRECISION_BITS = SUPER_MAN_BITS + 1;
+  // The products are exact, the terms of the sum are normalized to M bits
+  localparam int unsigned PROD_WIDTH = 2 * SRC_PRECISION;
+  localparam int unsigned TERM_WIDTH = fpnew_pkg::maximum(PROD_WIDTH, PRECISION_BITS);
+  // The terms are aligned to the largest one in a window of F bits below its leading bit. With
+  // F >= 2M+1 and F >= M+p+3, the bits of the smaller terms that fall out of the window are below
+  // the round bit of any result that is not an exact cancellation (which is handled separately).
+  localparam int unsigned FRAC_WIDTH = fpnew_pkg::maximum(2 * TERM_WIDTH + 1,
+                                                          TERM_WIDTH + PRECISION_BITS + 3);
+  // The sum of three terms needs two more integer bits and a sign bit
+  localparam int unsigned SUM_WIDTH  = FRAC_WIDTH + 3;
+  localparam int unsigned NORM_WIDTH = FRAC_WIDTH + 2;
+  localparam int unsigned LZC_RESULT_WIDTH = $clog2(NORM_WIDTH);
+  // Internal exponent, biased to the destination format, holds the exponents of products of
+  // subnormals and of MX block scaled products as well as that of zero terms
+  localparam int unsigned EXP_WIDTH =
+      fpnew_pkg::maximum(fpnew_pkg::maximum(SRC_EXP_BITS + 2, SUPER_EXP_BITS + 1),
+                         fpnew_pkg::MX_SCALE_BITS + 2) + 2;
+  localparam logic signed [EXP_WIDTH-1:0] ZERO_EXPONENT = -(2**(EXP_WIDTH-2));
+  // Shift amount widths: alignment shifts saturate at F bits, normalization at F+2 bits
+  localparam int unsigned ALIGN_SHAMT_WIDTH = $clog2(FRAC_WIDTH + 1);
+  localparam int unsigned NORM_SHAMT_WIDTH  = $clog2(NORM_WIDTH + 1);
+  // Pipelines
+  localparam NUM_INP_REGS = PipeConfig == fpnew_pkg::BEFORE
+                            ? NumPipeRegs
+                            : (PipeConfig == fpnew_pkg::DISTRIBUTED
+                               ? ((NumPipeRegs + 1) / 3) // Second to get distributed regs
+                               : 0); // no regs here otherwise
+  localparam NUM_MID_REGS = PipeConfig == fpnew_pkg::INSIDE
+                          ? NumPipeRegs
+                          : (PipeConfig == fpnew_pkg::DISTRIBUTED
+                             ? ((NumPipeRegs + 2) / 3) // First to get distributed regs
+                             : 0); // no regs here otherwise
+  localparam NUM_OUT_REGS = PipeConfig == fpnew_pkg::AFTER
+                            ? NumPipeRegs
+                            : (PipeConfig == fpnew_pkg::DISTRIBUTED
+                               ? (NumPipeRegs / 3) // Last to get distributed regs
+                               : 0); // no regs here otherwise
+
+  // ----------------
+  // Type definition
+  // ----------------
+  typedef struct packed {
+    logic                      sign;
+    logic [SUPER_EXP_BITS-1:0] exponent;
+    logic [SUPER_MAN_BITS-1:0] mantissa;
+  } fp_t;
+
+  // A term of the sum, normalized such that the leading one is the MSB of the mantissa. The
+  // exponent is signed and biased to the destination format.
+  typedef struct packed {
+    logic                  sign;
+    logic                  zero;
+    logic [EXP_WIDTH-1:0]  exponent;
+    logic [TERM_WIDTH-1:0] mantissa;
+  } term_t;
+
+  localparam term_t ZERO_TERM = '{sign: 1'b0, zero: 1'b1, exponent: ZERO_EXPONENT, mantissa: '0};
+
+  // ---------------
+  // Input pipeline
+  // ---------------
+  // Selected pipeline output signals as non-arrays
+  logic [2:0][WIDTH-1:0] operands_q;
+  logic [2:0]            is_boxed_q;
+  logic                  op_mod_q;
+  fpnew_pkg::fp_format_e src_fmt_q;
+  fpnew_pkg::fp_format_e dst_fmt_q;
+
+  // Input pipeline signals, index i holds signal after i register stages
+  logic                  [0:NUM_INP_REGS][2:0][WIDTH-1:0] inp_pipe_operands_q;
+  logic                  [0:NUM_INP_REGS][2:0]            inp_pipe_is_boxed_q;
+  fpnew_pkg::roundmode_e [0:NUM_INP_REGS]                 inp_pipe_rnd_mode_q;
+  logic                  [0:NUM_INP_REGS]                 inp_pipe_op_mod_q;
+  fpnew_pkg::fp_format_e [0:NUM_INP_REGS]                 inp_pipe_src_fmt_q;
+  fpnew_pkg::fp_format_e [0:NUM_INP_REGS]                 inp_pipe_dst_fmt_q;
+  fpnew_pkg::mx_scales_t [0:NUM_INP_REGS]                 inp_pipe_mx_scales_q;
+  TagType                [0:NUM_INP_REGS]                 inp_pipe_tag_q;
+  AuxType                [0:NUM_INP_REGS]                 inp_pipe_aux_q;
+  logic                  [0:NUM_INP_REGS]                 inp_pipe_valid_q;
+  // Ready signal is combinatorial for all stages
+  logic [0:NUM_INP_REGS] inp_pipe_ready;
+
+  // Input stage: First element of pipeline is taken from inputs
+  assign inp_pipe_operands_q[0]  = operands_i;
+  assign inp_pipe_is_boxed_q[0]  = is_boxed_i;
+  assign inp_pipe_rnd_mode_q[0]  = rnd_mode_i;
+  assign inp_pipe_op_mod_q[0]    = op_mod_i;
+  assign inp_pipe_src_fmt_q[0]   = src_fmt_i;
+  assign inp_pipe_dst_fmt_q[0]   = dst_fmt_i;
+  assign inp_pipe_mx_scales_q[0] = mx_scales_i;
+  assign inp_pipe_tag_q[0]       = tag_i;
+  assign inp_pipe_aux_q[0]       = aux_i;
+  assign inp_pipe_valid_q[0]     = in_valid_i;
+  // Input stage: Propagate pipeline ready signal to updtream circuitry
+  assign in_ready_o = inp_pipe_ready[0];
+  // Generate the register stages
+  for (genvar i = 0; i < NUM_INP_REGS; i++) begin : gen_input_pipeline
+    // Internal register enable for this stage
+    logic reg_ena;
+    // Determine the ready signal of the current stage - advance the pipeline:
+    // 1. if the next stage is ready for our data
+    // 2. if the next stage only holds a bubble (not valid) -> we can pop it
+    assign inp_pipe_ready[i] = inp_pipe_ready[i+1] | ~inp_pipe_valid_q[i+1];
+    // Valid: enabled by ready signal, synchronous clear with the flush signal
+    `FFLARNC(inp_pipe_valid_q[i+1], inp_pipe_valid_q[i], inp_pipe_ready[i], flush_i, 1'b0, clk_i, rst_ni)
+    // Enable register if pipleine ready and a valid data item is present
+    assign reg_ena = inp_pipe_ready[i] & inp_pipe_valid_q[i];
+    // Generate the pipeline registers within the stages, use enable-registers
+    `FFL(inp_pipe_operands_q[i+1],  inp_pipe_operands_q[i],  reg_ena, '0)
+    `FFL(inp_pipe_is_boxed_q[i+1],  inp_pipe_is_boxed_q[i],  reg_ena, '0)
+    `FFL(inp_pipe_rnd_mode_q[i+1],  inp_pipe_rnd_mode_q[i],  reg_ena, fpnew_pkg::RNE)
+    `FFL(inp_pipe_op_mod_q[i+1],    inp_pipe_op_mod_q[i],    reg_ena, '0)
+    `FFL(inp_pipe_src_fmt_q[i+1],   inp_pipe_src_fmt_q[i],   reg_ena, fpnew_pkg::fp_format_e'(0))
+    `FFL(inp_pipe_dst_fmt_q[i+1],   inp_pipe_dst_fmt_q[i],   reg_ena, fpnew_pkg::fp_format_e'(0))
+    `FFL(inp_pipe_mx_scales_q[i+1], inp_pipe_mx_scales_q[i], reg_ena, fpnew_pkg::MX_NO_SCALE)
+    `FFL(inp_pipe_tag_q[i+1],       inp_pipe_tag_q[i],       reg_ena, TagType'('0))
+    `FFL(inp_pipe_aux_q[i+1],       inp_pipe_aux_q[i],       reg_ena, AuxType'('0))
+  end
+  // Output stage: assign selected pipe outputs to signals for later use
+  assign operands_q = inp_pipe_operands_q[NUM_INP_REGS];
+  assign is_boxed_q = inp_pipe_is_boxed_q[NUM_INP_REGS];
+  assign op_mod_q   = inp_pipe_op_mod_q[NUM_INP_REGS];
+  assign src_fmt_q  = inp_pipe_src_fmt_q[NUM_INP_REGS];
+  assign dst_fmt_q  = inp_pipe_dst_fmt_q[NUM_INP_REGS];
+
+  // -----------------
+  // Input processing
+  // -----------------
+  // The vector elements are numbered {b[1], a[1], b[0], a[0]}, product i multiplies 2i and 2i+1
+  logic                [NUM_FORMATS-1:0][3:0]                   fmt_src_sign;
+  logic                [NUM_FORMATS-1:0][3:0][SRC_EXP_BITS-1:0] fmt_src_exponent;
+  logic                [NUM_FORMATS-1:0][3:0][SRC_MAN_BITS-1:0] fmt_src_mantissa;
+  fpnew_pkg::fp_info_t [NUM_FORMATS-1:0][3:0]                   fmt_src_info;
+
+  logic                [NUM_FORMATS-1:0]                     fmt_dst_sign;
+  logic                [NUM_FORMATS-1:0][SUPER_EXP_BITS-1:0] fmt_dst_exponent;
+  logic                [NUM_FORMATS-1:0][SUPER_MAN_BITS-1:0] fmt_dst_mantissa;
+  fpnew_pkg::fp_info_t [NUM_FORMATS-1:0]                     fmt_dst_info;
+
+  // FP Input initialization
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : fmt_init_inputs
+    // Set up some constants
+    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+
+    // Vector elements
+    if (SRC_FORMATS[fmt]) begin : active_src_format
+      logic [3:0][FP_WIDTH-1:0] elements;
+      logic [3:0]               elements_boxed;
+
+      // The elements are boxed if the vectors holding them are
+      assign elements       = {operands_q[1][2*FP_WIDTH-1:FP_WIDTH],
+                               operands_q[0][2*FP_WIDTH-1:FP_WIDTH],
+                               operands_q[1][FP_WIDTH-1:0],
+                               operands_q[0][FP_WIDTH-1:0]};
+      assign elements_boxed = {is_boxed_q[1], is_boxed_q[0], is_boxed_q[1], is_boxed_q[0]};
+
+      // Classify input
+      fpnew_classifier #(
+        .FpFormat    ( fpnew_pkg::fp_format_e'(fmt) ),
+        .NumOperands ( 4                            )
+      ) i_src_classifier (
+        .operands_i ( elements          ),
+        .is_boxed_i ( elements_boxed    ),
+        .info_o     ( fmt_src_info[fmt] )
+      );
+      for (genvar elem = 0; elem < 4; elem++) begin : gen_elements
+        assign fmt_src_sign[fmt][elem]     = elements[elem][FP_WIDTH-1];
+        assign fmt_src_exponent[fmt][elem] = elements[elem][MAN_BITS+:EXP_BITS];
+        assign fmt_src_mantissa[fmt][elem] = elements[elem][MAN_BITS-1:0] <<
+                                             (SRC_MAN_BITS - MAN_BITS); // move to left of mantissa
+      end
+    end else begin : inactive_src_format
+      assign fmt_src_info[fmt]     = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_src_sign[fmt]     = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_src_exponent[fmt] = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_src_mantissa[fmt] = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+    end
+
+    // Addend
+    if (DST_FORMATS[fmt]) begin : active_dst_format
+      // Classify input
+      fpnew_classifier #(
+        .FpFormat    ( fpnew_pkg::fp_format_e'(fmt) ),
+        .NumOperands ( 1                            )
+      ) i_dst_classifier (
+        .operands_i ( operands_q[2][FP_WIDTH-1:0] ),
+        .is_boxed_i ( is_boxed_q[2]               ),
+        .info_o     ( fmt_dst_info[fmt]           )
+      );
+      assign fmt_dst_sign[fmt]     = operands_q[2][FP_WIDTH-1];
+      assign fmt_dst_exponent[fmt] = operands_q[2][MAN_BITS+:EXP_BITS];
+      assign fmt_dst_mantissa[fmt] = operands_q[2][MAN_BITS-1:0] <<
+                                     (SUPER_MAN_BITS - MAN_BITS); // move to left of mantissa
+    end else begin : inactive_dst_format
+      assign fmt_dst_info[fmt]     = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_dst_sign[fmt]     = fpnew_pkg::DONT_CARE;             // format disabled
+      assign fmt_dst_exponent[fmt] = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_dst_mantissa[fmt] = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+    end
+  end
+
+  fpnew_pkg::fp_info_t [3:0] info_elem;
+  fp_t                       operand_c;
+  fpnew_pkg::fp_info_t       info_c;
+
+  assign info_elem = fmt_src_info[src_fmt_q];
+  assign info_c    = fmt_dst_info[dst_fmt_q];
+  // op_mod_q inverts the sign of the addend
+  assign operand_c = {fmt_dst_sign[dst_fmt_q] ^ op_mod_q,
+                      fmt_dst_exponent[dst_fmt_q],
+                      fmt_dst_mantissa[dst_fmt_q]};
+
+  // -----------------
+  // MX block scaling
+  // -----------------
+  logic signed [EXP_WIDTH-1:0] scale_offset; // exponent added to both products
+  logic                        scale_is_nan;
+  fpnew_pkg::mx_scales_t       scales_q;
+
+  assign scales_q     = inp_pipe_mx_scales_q[NUM_INP_REGS];
+  assign scale_offset = signed'(EXP_WIDTH'(scales_q[0])) + signed'(EXP_WIDTH'(scales_q[1]))
+                        - signed'(EXP_WIDTH'(2 * fpnew_pkg::MX_SCALE_BIAS));
+  assign scale_is_nan = (scales_q[0] == '1) || (scales_q[1] == '1);
+
+  // ---------------------
+  // Input classification
+  // ---------------------
+  logic [1:0] product_sign, product_inf, product_invalid;
+  logic       any_operand_nan;
+  logic       signalling_nan;
+  logic       pos_inf, neg_inf;
+
+  for (genvar prod = 0; prod < 2; prod++) begin : gen_product_class
+    assign product_sign[prod]    = fmt_src_sign[src_fmt_q][2*prod] ^
+                                   fmt_src_sign[src_fmt_q][2*prod+1];
+    assign product_inf[prod]     = info_elem[2*prod].is_inf | info_elem[2*prod+1].is_inf;
+    // inf * 0 is invalid
+    assign product_invalid[prod] = (info_elem[2*prod].is_inf && info_elem[2*prod+1].is_zero) ||
+                                   (info_elem[2*prod].is_zero && info_elem[2*prod+1].is_inf);
+  end
+
+  // Reduction for special case handling
+  assign any_operand_nan = (| {info_elem[0].is_nan, info_elem[1].is_nan, info_elem[2].is_nan,
+                               info_elem[3].is_nan, info_c.is_nan});
+  assign signalling_nan  = (| {info_elem[0].is_signalling, info_elem[1].is_signalling,
+                               info_elem[2].is_signalling, info_elem[3].is_signalling,
+                               info_c.is_signalling});
+  // Infinite terms of either sign
+  assign pos_inf = (product_inf[0] & ~product_sign[0]) | (product_inf[1] & ~product_sign[1]) |
+                   (info_c.is_inf & ~operand_c.sign);
+  assign neg_inf = (product_inf[0] & product_sign[0]) | (product_inf[1] & product_sign[1]) |
+                   (info_c.is_inf & operand_c.sign);
+
+  // ----------------------
+  // Special case handling
+  // ----------------------
+  logic [WIDTH-1:0]   special_result;
+  fpnew_pkg::status_t special_status;
+  logic               result_is_special;
+
+  logic [NUM_FORMATS-1:0][WIDTH-1:0]    fmt_special_result;
+  fpnew_pkg::status_t [NUM_FORMATS-1:0] fmt_special_status;
+  logic [NUM_FORMATS-1:0]               fmt_result_is_special;
+
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_special_results
+    // Set up some constants
+    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+
+    localparam logic [EXP_BITS-1:0] QNAN_EXPONENT = '1;
+    localparam logic [MAN_BITS-1:0] QNAN_MANTISSA = 2**(MAN_BITS-1);
+    localparam logic [MAN_BITS-1:0] ZERO_MANTISSA = '0;
+
+    if (DST_FORMATS[fmt]) begin : active_format
+      always_comb begin : special_results
+        logic [FP_WIDTH-1:0] special_res;
+
+        // Default assignment
+        special_res                = {1'b0, QNAN_EXPONENT, QNAN_MANTISSA}; // qNaN
+        fmt_special_status[fmt]    = '0;
+        fmt_result_is_special[fmt] = 1'b0;
+
+        // A NaN block scale makes the result NaN, without raising a flag
+        if (scale_is_nan) begin
+          fmt_result_is_special[fmt] = 1'b1; // bypass datapath, output is the canonical qNaN
+        // RISC-V mandates raising the NV exception for inf * 0 products, no matter the other terms
+        // (even quiet NaNs)
+        end else if (| product_invalid) begin
+          fmt_result_is_special[fmt] = 1'b1; // bypass datapath, output is the canonical qNaN
+          fmt_special_status[fmt].NV = 1'b1; // invalid operation
+        // NaN Inputs cause canonical quiet NaN at the output and maybe invalid OP
+        end else if (any_operand_nan) begin
+          fmt_result_is_special[fmt] = 1'b1;           // bypass datapath, output is the canonical qNaN
+          fmt_special_status[fmt].NV = signalling_nan; // raise the invalid operation flag if signalling
+        // Special cases involving infinity
+        end else if (pos_inf || neg_inf) begin
+          fmt_result_is_special[fmt] = 1'b1; // bypass datapath
+          // Effective addition of opposite infinities (±inf - ±inf) is invalid!
+          if (pos_inf && neg_inf)
+            fmt_special_status[fmt].NV = 1'b1; // invalid operation
+          // Otherwise the result is infinity with the sign of the infinite terms
+          else
+            special_res = {neg_inf, QNAN_EXPONENT, ZERO_MANTISSA};
+        end
+        // Initialize special result with ones (NaN-box)
+        fmt_special_result[fmt]               = '1;
+        fmt_special_result[fmt][FP_WIDTH-1:0] = special_res;
+      end
+    end else begin : inactive_format
+      assign fmt_special_result[fmt]    = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_special_status[fmt]    = '0;
+      assign fmt_result_is_special[fmt] = 1'b0;
+    end
+  end
+
+  assign result_is_special = fmt_result_is_special[dst_fmt_q]; // they're all the same
+  assign special_status    = fmt_special_status[dst_fmt_q];
+  assign special_result    = fmt_special_result[dst_fmt_q];
+
+  // ------------------
+  // Product data path
+  // ------------------
+  term_t [2:0] terms; // products 0 and 1, addend
+
+  for (genvar prod = 0; prod < 2; prod++) begin : gen_products
+    logic [SRC_PRECISION-1:0]          mantissa_a, mantissa_b;
+    logic [PROD_WIDTH-1:0]             product, product_normalized;
+    logic [$clog2(PROD_WIDTH)-1:0]     product_lzc;
+    logic                              product_lzc_zeroes;
+    logic signed [EXP_WIDTH-1:0]       exponent_a, exponent_b, exponent_product;
+
+    // Add implicit bits to mantissae
+    assign mantissa_a = {info_elem[2*prod].is_normal,   fmt_src_mantissa[src_fmt_q][2*prod]};
+    assign mantissa_b = {info_elem[2*prod+1].is_normal, fmt_src_mantissa[src_fmt_q][2*prod+1]};
+
+    // Mantissa multiplier, the p*p product is 2p bits wide and exact
+    assign product = mantissa_a * mantissa_b;
+
+    // Products of subnormal elements are normalized
+    lzc #(
+      .WIDTH ( PROD_WIDTH ),
+      .MODE  ( 1          ) // MODE = 1 counts leading zeroes
+    ) i_product_lzc (
+      .in_i    ( product            ),
+      .cnt_o   ( product_lzc        ),
+      .empty_o ( product_lzc_zeroes )
+    );
+
+    assign product_normalized = product << product_lzc;
+
+    // Real exponents are (ex = Ex - bias + 1 - nx), the leading bit of the product has the weight 2
+    assign exponent_a = signed'({1'b0, fmt_src_exponent[src_fmt_q][2*prod]}) +
+                        signed'({1'b0, info_elem[2*prod].is_subnormal});
+    assign exponent_b = signed'({1'b0, fmt_src_exponent[src_fmt_q][2*prod+1]}) +
+                        signed'({1'b0, info_elem[2*prod+1].is_subnormal});
+    assign exponent_product = exponent_a + exponent_b
+                              - 2*signed'(fpnew_pkg::bias(src_fmt_q))
+                              + signed'(fpnew_pkg::bias(dst_fmt_q)) // rebias for dst fmt
+                              + 1 - signed'({1'b0, product_lzc})
+                              + scale_offset; // MX block scales
+
+    always_comb begin : product_term
+      terms[prod].sign     = product_sign[prod];
+      terms[prod].zero     = info_elem[2*prod].is_zero | info_elem[2*prod+1].is_zero;
+      terms[prod].exponent = exponent_product;
+      terms[prod].mantissa = TERM_WIDTH'(product_normalized) << (TERM_WIDTH - PROD_WIDTH);
+      // Zero products are placed below all other terms
+      if (terms[prod].zero || product_lzc_zeroes) terms[prod] = ZERO_TERM;
+      terms[prod].sign = product_sign[prod];
+    end
+  end
+
+  // -----------------
+  // Addend data path
+  // -----------------
+  logic [PRECISION_BITS-1:0]         mantissa_c, mantissa_c_normalized;
+  logic [$clog2(PRECISION_BITS)-1:0] addend_lzc;
+  logic                              addend_lzc_zeroes;
+
+  assign mantissa_c = {info_c.is_normal, operand_c.mantissa};
+
+  // Subnormal addends are normalized
+  lzc #(
+    .WIDTH ( PRECISION_BITS ),
+    .MODE  ( 1              ) // MODE = 1 counts leading zeroes
+  ) i_addend_lzc (
+    .in_i    ( mantissa_c        ),
+    .cnt_o   ( addend_lzc        ),
+    .empty_o ( addend_lzc_zeroes )
+  );
+
+  assign mantissa_c_normalized = mantissa_c << addend_lzc;
+
+  always_comb begin : addend_term
+    terms[2].sign     = operand_c.sign;
+    terms[2].zero     = info_c.is_zero;
+    terms[2].exponent = signed'({1'b0, operand_c.exponent}) + signed'({1'b0, info_c.is_subnormal})
+                        - signed'({1'b0, addend_lzc});
+    terms[2].mantissa = TERM_WIDTH'(mantissa_c_normalized) << (TERM_WIDTH - PRECISION_BITS);
+    // Zero addends are placed below all other terms
+    if (info_c.is_zero || addend_lzc_zeroes) terms[2] = ZERO_TERM;
+    terms[2].sign = operand_c.sign;
+  end
+
+  // Exact zero results take the common sign of the terms, otherwise they are rounded like the sum of
+  // two terms with opposite signs
+  logic effective_subtraction;
+  assign effective_subtraction = (terms[0].sign != terms[1].sign) || (terms[1].sign != terms[2].sign);
+
+  // ---------------------
+  // Term sorting
+  // ---------------------
+  term_t term_big, term_mid, term_small; // sorted by exponent
+  term_t big, mid, small;                // after reduction
+
+  always_comb begin : sort_terms
+    if (signed'(terms[0].exponent) >= signed'(terms[1].exponent) &&
+        signed'(terms[0].exponent) >= signed'(terms[2].exponent)) begin
+      term_big = terms[0];
+      {term_mid, term_small} = (signed'(terms[1].exponent) >= signed'(terms[2].exponent))
+                               ? {terms[1], terms[2]}
+                               : {terms[2], terms[1]};
+    end else if (signed'(terms[1].exponent) >= signed'(terms[2].exponent)) begin
+      term_big = terms[1];
+      {term_mid, term_small} = (signed'(terms[0].exponent) >= signed'(terms[2].exponent))
+                               ? {terms[0], terms[2]}
+                               : {terms[2], terms[0]};
+    end else begin
+      term_big = terms[2];
+      {term_mid, term_small} = (signed'(terms[0].exponent) >= signed'(terms[1].exponent))
+                               ? {terms[0], terms[1]}
+                               : {terms[1], terms[0]};
+    end
+  end
+
+  logic signed [EXP_WIDTH-1:0] exponent_difference_mid;
+  logic                        big_mid_cancel, mid_small_cancel, small_larger, mid_is_far;
+
+  assign exponent_difference_mid = signed'(term_big.exponent) - signed'(term_mid.exponent);
+
+  // The two largest terms cancel exactly, only the smallest term remains
+  assign big_mid_cancel   = !term_big.zero && (term_big.exponent == term_mid.exponent) &&
+                            (term_big.mantissa == term_mid.mantissa) &&
+                            (term_big.sign != term_mid.sign);
+  assign mid_small_cancel = !term_mid.zero && (term_mid.exponent == term_small.exponent) &&
+                            (term_mid.mantissa == term_small.mantissa) &&
+                            (term_mid.sign != term_small.sign);
+  assign small_larger     = (term_mid.exponent == term_small.exponent) &&
+                            (term_small.mantissa > term_mid.mantissa);
+  // The middle term does not fit into the window below the largest term
+  assign mid_is_far       = exponent_difference_mid > signed'(FRAC_WIDTH - TERM_WIDTH);
+
+  // At most one term may lose bits in the alignment, such that its sticky bit has a known sign
+  always_comb begin : reduce_terms
+    big   = term_big;
+    mid   = term_mid;
+    small = term_small;
+    // The smallest term is the exact result if the others cancel
+    if (big_mid_cancel) begin
+      big   = term_small;
+      mid   = ZERO_TERM;
+      small = ZERO_TERM;
+    // The two smaller terms only affect the result through the sign of their sum, which is that
+    // of the larger one. Their sum is represented by the larger term.
+    end else if (mid_is_far) begin
+      mid   = ZERO_TERM;
+      small = mid_small_cancel ? ZERO_TERM : (small_larger ? term_small : term_mid);
+    end
+  end
+
+  // ----------------
+  // Alignment
+  // ----------------
+  logic signed [EXP_WIDTH-1:0]  exponent_difference_small;
+  logic [ALIGN_SHAMT_WIDTH-1:0] mid_shamt, small_shamt;
+
+  assign exponent_difference_small = signed'(big.exponent) - signed'(small.exponent);
+
+  // Shift amounts saturate such that the whole mantissa is shifted into the sticky bits
+  assign mid_shamt   = (signed'(big.exponent) - signed'(mid.exponent) >= signed'(FRAC_WIDTH))
+                       ? FRAC_WIDTH
+                       : ALIGN_SHAMT_WIDTH'(unsigned'(signed'(big.exponent) -
+                                                      signed'(mid.exponent)));
+  assign small_shamt = (exponent_difference_small >= signed'(FRAC_WIDTH))
+                       ? FRAC_WIDTH
+                       : ALIGN_SHAMT_WIDTH'(unsigned'(exponent_difference_small));
+
+  logic [FRAC_WIDTH-1:0] big_aligned, mid_aligned, small_aligned;
+  logic [TERM_WIDTH-1:0] mid_sticky_bits, small_sticky_bits;
+  logic                  sticky_before_add;
+
+  // The largest term is placed at the top of the window:
+  // | mantissa | 000...000 |
+  //  <-  M   -> <- F-M  ->
+  assign big_aligned = {big.mantissa, {(FRAC_WIDTH-TERM_WIDTH){1'b0}}};
+  // The smaller terms are shifted right by their exponent difference, up to M bits are sticky
+  assign {mid_aligned, mid_sticky_bits}     = {mid.mantissa, {FRAC_WIDTH{1'b0}}} >> mid_shamt;
+  assign {small_aligned, small_sticky_bits} = {small.mantissa, {FRAC_WIDTH{1'b0}}} >> small_shamt;
+
+  // The middle term always fits the window after the reduction
+  assign sticky_before_add = (| small_sticky_bits);
+
+  // ------
+  // Adder
+  // ------
+  logic                 eff_sub_mid, eff_sub_small;
+  logic [SUM_WIDTH-1:0] mid_addend, small_addend;
+  logic [SUM_WIDTH-1:0] sum_raw;      // signed sum relative to the sign of the largest term
+  logic                 sum_negative;
+  logic [NORM_WIDTH-1:0] sum;         // absolute value of the sum
+  logic                 final_sign;
+
+  assign eff_sub_mid   = big.sign ^ mid.sign;
+  assign eff_sub_small = big.sign ^ small.sign;
+
+  // Subtracted terms are inverted, the carry for the two's complement is only injected without
+  // sticky bits. The discarded bits then always increase the magnitude of the sum.
+  assign mid_addend   = eff_sub_mid   ? ~SUM_WIDTH'(mid_aligned)   : SUM_WIDTH'(mid_aligned);
+  assign small_addend = eff_sub_small ? ~SUM_WIDTH'(small_aligned) : SUM_WIDTH'(small_aligned);
+
+  assign sum_raw = SUM_WIDTH'(big_aligned) + mid_addend + small_addend
+                   + eff_sub_mid + (eff_sub_small & ~sticky_before_add);
+  assign sum_negative = sum_raw[SUM_WIDTH-1];
+
+  // Complement negative sums, the discarded bits decrease the magnitude of negative sums
+  assign sum = sum_negative
+               ? (sticky_before_add ? ~sum_raw[NORM_WIDTH-1:0] : -sum_raw[NORM_WIDTH-1:0])
+               : sum_raw[NORM_WIDTH-1:0];
+
+  assign final_sign = big.sign ^ sum_negative;
+
+  // ---------------
+  // Internal pipeline
+  // ---------------
+  // Pipeline output signals as non-arrays
+  logic                        effective_subtraction_q;
+  logic signed [EXP_WIDTH-1:0] exponent_big_q;
+  logic                        sticky_before_add_q;
+  logic [NORM_WIDTH-1:0]       sum_q;
+  logic                        final_sign_q;
+  fpnew_pkg::fp_format_e       dst_fmt_q2;
+  fpnew_pkg::roundmode_e       rnd_mode_q;
+  logic                        result_is_special_q;
+  logic [WIDTH-1:0]            special_result_q;
+  fpnew_pkg::status_t          special_status_q;
+  // Internal pipeline signals, index i holds signal after i register stages
+  logic                  [0:NUM_MID_REGS]                 mid_pipe_eff_sub_q;
+  logic signed           [0:NUM_MID_REGS][EXP_WIDTH-1:0]  mid_pipe_exp_big_q;
+  logic                  [0:NUM_MID_REGS]                 mid_pipe_sticky_q;
+  logic                  [0:NUM_MID_REGS][NORM_WIDTH-1:0] mid_pipe_sum_q;
+  logic                  [0:NUM_MID_REGS]                 mid_pipe_final_sign_q;
+  fpnew_pkg::roundmode_e [0:NUM_MID_REGS]                 mid_pipe_rnd_mode_q;
+  fpnew_pkg::fp_format_e [0:NUM_MID_REGS]                 mid_pipe_dst_fmt_q;
+  logic                  [0:NUM_MID_REGS]                 mid_pipe_res_is_spec_q;
+  logic                  [0:NUM_MID_REGS][WIDTH-1:0]      mid_pipe_spec_res_q;
+  fpnew_pkg::status_t    [0:NUM_MID_REGS]                 mid_pipe_spec_stat_q;
+  TagType                [0:NUM_MID_REGS]                 mid_pipe_tag_q;
+  AuxType                [0:NUM_MID_REGS]                 mid_pipe_aux_q;
+  logic                  [0:NUM_MID_REGS]                 mid_pipe_valid_q;
+  // Ready signal is combinatorial for all stages
+  logic [0:NUM_MID_REGS] mid_pipe_ready;
+
+  // Input stage: First element of pipeline is taken from upstream logic
+  assign mid_pipe_eff_sub_q[0]     = effective_subtraction;
+  assign mid_pipe_exp_big_q[0]     = big.exponent;
+  assign mid_pipe_sticky_q[0]      = sticky_before_add;
+  assign mid_pipe_sum_q[0]         = sum;
+  assign mid_pipe_final_sign_q[0]  = final_sign;
+  assign mid_pipe_rnd_mode_q[0]    = inp_pipe_rnd_mode_q[NUM_INP_REGS];
+  assign mid_pipe_dst_fmt_q[0]     = dst_fmt_q;
+  assign mid_pipe_res_is_spec_q[0] = result_is_special;
+  assign mid_pipe_spec_res_q[0]    = special_result;
+  assign mid_pipe_spec_stat_q[0]   = special_status;
+  assign mid_pipe_tag_q[0]         = inp_pipe_tag_q[NUM_INP_REGS];
+  assign mid_pipe_aux_q[0]         = inp_pipe_aux_q[NUM_INP_REGS];
+  assign mid_pipe_valid_q[0]       = inp_pipe_valid_q[NUM_INP_REGS];
+  // Input stage: Propagate pipeline ready signal to input pipe
+  assign inp_pipe_ready[NUM_INP_REGS] = mid_pipe_ready[0];
+
+  // Generate the register stages
+  for (genvar i = 0; i < NUM_MID_REGS; i++) begin : gen_inside_pipeline
+    // Internal register enable for this stage
+    logic reg_ena;
+    // Determine the ready signal of the current stage - advance the pipeline:
+    // 1. if the next stage is ready for our data
+    // 2. if the next stage only holds a bubble (not valid) -> we can pop it
+    assign mid_pipe_ready[i] = mid_pipe_ready[i+1] | ~mid_pipe_valid_q[i+1];
+    // Valid: enabled by ready signal, synchronous clear with the flush signal
+    `FFLARNC(mid_pipe_valid_q[i+1], mid_pipe_valid_q[i], mid_pipe_ready[i], flush_i, 1'b0, clk_i, rst_ni)
+    // Enable register if pipleine ready and a valid data item is present
+    assign reg_ena = mid_pipe_ready[i] & mid_pipe_valid_q[i];
+    // Generate the pipeline registers within the stages, use enable-registers
+    `FFL(mid_pipe_eff_sub_q[i+1],     mid_pipe_eff_sub_q[i],     reg_ena, '0)
+    `FFL(mid_pipe_exp_big_q[i+1],     mid_pipe_exp_big_q[i],     reg_ena, '0)
+    `FFL(mid_pipe_sticky_q[i+1],      mid_pipe_sticky_q[i],      reg_ena, '0)
+    `FFL(mid_pipe_sum_q[i+1],         mid_pipe_sum_q[i],         reg_ena, '0)
+    `FFL(mid_pipe_final_sign_q[i+1],  mid_pipe_final_sign_q[i],  reg_ena, '0)
+    `FFL(mid_pipe_rnd_mode_q[i+1],    mid_pipe_rnd_mode_q[i],    reg_ena, fpnew_pkg::RNE)
+    `FFL(mid_pipe_dst_fmt_q[i+1],     mid_pipe_dst_fmt_q[i],     reg_ena, fpnew_pkg::fp_format_e'(0))
+    `FFL(mid_pipe_res_is_spec_q[i+1], mid_pipe_res_is_spec_q[i], reg_ena, '0)
+    `FFL(mid_pipe_spec_res_q[i+1],    mid_pipe_spec_res_q[i],    reg_ena, '0)
+    `FFL(mid_pipe_spec_stat_q[i+1],   mid_pipe_spec_stat_q[i],   reg_ena, '0)
+    `FFL(mid_pipe_tag_q[i+1],         mid_pipe_tag_q[i],         reg_ena, TagType'('0))
+    `FFL(mid_pipe_aux_q[i+1],         mid_pipe_aux_q[i],         reg_ena, AuxType'('0))
+  end
+  // Output stage: assign selected pipe outputs to signals for later use
+  assign effective_subtraction_q = mid_pipe_eff_sub_q[NUM_MID_REGS];
+  assign exponent_big_q          = mid_pipe_exp_big_q[NUM_MID_REGS];
+  assign sticky_before_add_q     = mid_pipe_sticky_q[NUM_MID_REGS];
+  assign sum_q                   = mid_pipe_sum_q[NUM_MID_REGS];
+  assign final_sign_q            = mid_pipe_final_sign_q[NUM_MID_REGS];
+  assign rnd_mode_q              = mid_pipe_rnd_mode_q[NUM_MID_REGS];
+  assign dst_fmt_q2              = mid_pipe_dst_fmt_q[NUM_MID_REGS];
+  assign result_is_special_q     = mid_pipe_res_is_spec_q[NUM_MID_REGS];
+  assign special_result_q        = mid_pipe_spec_res_q[NUM_MID_REGS];
+  assign special_status_q        = mid_pipe_spec_stat_q[NUM_MID_REGS];
+
+  // --------------
+  // Normalization
+  // --------------
+  logic        [LZC_RESULT_WIDTH-1:0] leading_zero_count;     // the number of leading zeroes
+  logic signed [LZC_RESULT_WIDTH:0]   leading_zero_count_sgn; // signed leading-zero count
+  logic                               lzc_zeroes;             // in case only zeroes found
+  logic signed [EXP_WIDTH-1:0]        leading_exponent;       // exponent of the leading bit
+
+  logic                        norm_left;  // Normalization shift direction
+  logic [NORM_SHAMT_WIDTH-1:0] norm_shamt; // Normalization shift amount
+  logic signed [EXP_WIDTH-1:0] final_exponent;
+
+  logic [NORM_WIDTH-1:0]       sum_shifted;       // result after normalization shift
+  logic [NORM_WIDTH-1:0]       sum_shifted_out;   // bits shifted out for tiny results
+  logic [PRECISION_BITS:0]     final_mantissa;    // final mantissa before rounding with round bit
+  logic [NORM_WIDTH-PRECISION_BITS-2:0] sum_sticky_bits; // remaining sticky bits after normalization
+  logic                        sticky_after_norm; // sticky bit after normalization
+
+  // Leading zero counter for cancellations
+  lzc #(
+    .WIDTH ( NORM_WIDTH ),
+    .MODE  ( 1          ) // MODE = 1 counts leading zeroes
+  ) i_lzc (
+    .in_i    ( sum_q              ),
+    .cnt_o   ( leading_zero_count ),
+    .empty_o ( lzc_zeroes         )
+  );
+
+  assign leading_zero_count_sgn = signed'({1'b0, leading_zero_count});
+  // The MSB of the sum has two integer bits above the leading bit of the largest term
+  assign leading_exponent = exponent_big_q + 2 - leading_zero_count_sgn;
+
+  // Normalization shift amount based on exponents and LZC
+  always_comb begin : norm_shift_amount
+    norm_left = 1'b1;
+    // Zero result
+    if (lzc_zeroes) begin
+      norm_shamt     = '0;
+      final_exponent = '0;
+    // Normal result, remove the counted zeroes
+    end else if (leading_exponent > 0) begin
+      norm_shamt     = NORM_SHAMT_WIDTH'(leading_zero_count);
+      final_exponent = leading_exponent;
+    // Subnormal result, align mantissa with minimum exponent (subnormals encoded as 0)
+    end else if (exponent_big_q + 1 >= 0) begin
+      norm_shamt     = NORM_SHAMT_WIDTH'(unsigned'(exponent_big_q + 1));
+      final_exponent = '0;
+    // Result far below the subnormal range, shift right (saturated)
+    end else begin
+      norm_left      = 1'b0;
+      norm_shamt     = (-(exponent_big_q + 1) >= signed'(NORM_WIDTH))
+                       ? NORM_WIDTH
+                       : NORM_SHAMT_WIDTH'(unsigned'(-(exponent_big_q + 1)));
+      final_exponent = '0;
+    end
+  end
+
+  // Do the normalization shift
+  always_comb begin : norm_shift
+    if (norm_left) begin
+      sum_shifted     = sum_q << norm_shamt;
+      sum_shifted_out = '0;
+    end else begin
+      {sum_shifted, sum_shifted_out} = {sum_q, {NORM_WIDTH{1'b0}}} >> norm_shamt;
+    end
+  end
+
+  assign {final_mantissa, sum_sticky_bits} = sum_shifted;
+
+  // Update the sticky bit with the shifted-out bits
+  assign sticky_after_norm = (| sum_sticky_bits) | (| sum_shifted_out) | sticky_before_add_q;
+
+  // ----------------------------
+  // Rounding and classification
+  // ----------------------------
+  logic                                     pre_round_sign;
+  logic [SUPER_EXP_BITS+SUPER_MAN_BITS-1:0] pre_round_abs; // absolute value of result before rounding
+  logic [1:0]                               round_sticky_bits;
+
+  logic of_before_round, of_after_round; // overflow
+  logic uf_after_round;                  // underflow
+
+  logic [NUM_FORMATS-1:0][SUPER_EXP_BITS+SUPER_MAN_BITS-1:0] fmt_pre_round_abs; // per format
+  logic [NUM_FORMATS-1:0][1:0]                               fmt_round_sticky_bits;
+
+  logic [NUM_FORMATS-1:0]                                    fmt_of_after_round;
+  logic [NUM_FORMATS-1:0]                                    fmt_uf_after_round;
+
+  logic                                     rounded_sign;
+  logic [SUPER_EXP_BITS+SUPER_MAN_BITS-1:0] rounded_abs; // absolute value of result after rounding
+  logic                                     result_zero;
+
+  // Classification before round. RISC-V mandates checking underflow AFTER rounding!
+  assign of_before_round = final_exponent >= 2**(fpnew_pkg::exp_bits(dst_fmt_q2))-1; // infinity exponent is all ones
+
+  // Pack exponent and mantissa into proper rounding form
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_res_assemble
+    // Set up some constants
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+
+    logic [EXP_BITS-1:0] pre_round_exponent;
+    logic [MAN_BITS-1:0] pre_round_mantissa;
+
+    if (DST_FORMATS[fmt]) begin : active_format
+
+      assign pre_round_exponent = (of_before_round) ? 2**EXP_BITS-2 : final_exponent[EXP_BITS-1:0];
+      assign pre_round_mantissa = (of_before_round) ? '1 : final_mantissa[SUPER_MAN_BITS-:MAN_BITS];
+      // Assemble result before rounding. In case of overflow, the largest normal value is set.
+      assign fmt_pre_round_abs[fmt] = {pre_round_exponent, pre_round_mantissa}; // 0-extend
+
+      // Round bit is after mantissa (1 in case of overflow for rounding)
+      assign fmt_round_sticky_bits[fmt][1] = final_mantissa[SUPER_MAN_BITS-MAN_BITS] |
+                                             of_before_round;
+
+      // remaining bits in mantissa to sticky (1 in case of overflow for rounding)
+      if (MAN_BITS < SUPER_MAN_BITS) begin : narrow_sticky
+        assign fmt_round_sticky_bits[fmt][0] = (| final_mantissa[SUPER_MAN_BITS-MAN_BITS-1:0]) |
+                                               sticky_after_norm | of_before_round;
+      end else begin : normal_sticky
+        assign fmt_round_sticky_bits[fmt][0] = sticky_after_norm | of_before_round;
+      end
+    end else begin : inactive_format
+      assign fmt_pre_round_abs[fmt] = '{default: fpnew_pkg::DONT_CARE};
+      assign fmt_round_sticky_bits[fmt] = '{default: fpnew_pkg::DONT_CARE};
+    end
+  end
+
+  // Assemble result before rounding. In case of overflow, the largest normal value is set.
+  assign pre_round_sign     = final_sign_q;
+  assign pre_round_abs      = fmt_pre_round_abs[dst_fmt_q2];
+
+  // In case of overflow, the round and sticky bits are set for proper rounding
+  assign round_sticky_bits  = fmt_round_sticky_bits[dst_fmt_q2];
+
+  // Perform the rounding
+  fpnew_rounding #(
+    .AbsWidth ( SUPER_EXP_BITS + SUPER_MAN_BITS )
+  ) i_fpnew_rounding (
+    .abs_value_i             ( pre_round_abs           ),
+    .sign_i                  ( pre_round_sign          ),
+    .round_sticky_bits_i     ( round_sticky_bits       ),
+    .rnd_mode_i              ( rnd_mode_q              ),
+    .effective_subtraction_i ( effective_subtraction_q ),
+    .fraction_i              ( '0                      ), // no stochastic rounding
+    .random_i                ( '0                      ), // no stochastic rounding
+    .abs_rounded_o           ( rounded_abs             ),
+    .sign_o                  ( rounded_sign            ),
+    .exact_zero_o            ( result_zero             )
+  );
+
+  logic [NUM_FORMATS-1:0][WIDTH-1:0] fmt_result;
+
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_sign_inject
+    // Set up some constants
+    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned EXP_BITS = fpnew_pkg::exp_bits(fpnew_pkg::fp_format_e'(fmt));
+    localparam int unsigned MAN_BITS = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt));
+
+    if (DST_FORMATS[fmt]) begin : active_format
+      always_comb begin : post_process
+        // detect of / uf
+        fmt_uf_after_round[fmt] = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '0; // denormal
+        fmt_of_after_round[fmt] = rounded_abs[EXP_BITS+MAN_BITS-1:MAN_BITS] == '1; // inf exp.
+
+        // Assemble regular result, nan box short ones.
+        fmt_result[fmt]               = '1;
+        fmt_result[fmt][FP_WIDTH-1:0] = {rounded_sign, rounded_abs[EXP_BITS+MAN_BITS-1:0]};
+      end
+    end else begin : inactive_format
+      assign fmt_uf_after_round[fmt] = fpnew_pkg::DONT_CARE;
+      assign fmt_of_after_round[fmt] = fpnew_pkg::DONT_CARE;
+      assign fmt_result[fmt]         = '{default: fpnew_pkg::DONT_CARE};
+    end
+  end
+
+  // Classification after rounding select by destination format
+  assign uf_after_round = fmt_uf_after_round[dst_fmt_q2];
+  assign of_after_round = fmt_of_after_round[dst_fmt_q2];
+
+  // -----------------
+  // Result selection
+  // -----------------
+  logic [WIDTH-1:0]     regular_result;
+  fpnew_pkg::status_t   regular_status;
+
+  // Assemble regular result
+  assign regular_result = fmt_result[dst_fmt_q2];
+  assign regular_status.NV = 1'b0; // only valid cases are handled in regular path
+  assign regular_status.DZ = 1'b0; // no divisions
+  assign regular_status.OF = of_before_round | of_after_round;   // rounding can introduce overflow
+  assign regular_status.UF = uf_after_round & regular_status.NX; // only inexact results raise UF
+  assign regular_status.NX = (| round_sticky_bits) | of_before_round | of_after_round;
+
+  // Final results for output pipeline
+  logic [WIDTH-1:0]   result_d;
+  fpnew_pkg::status_t status_d;
+
+  // Select output depending on special case detection
+  assign result_d = result_is_special_q ? special_result_q : regular_result;
+  assign status_d = result_is_special_q ? special_status_q : regular_status;
+
+  // ----------------
+  // Output Pipeline
+  // ----------------
+  // Output pipeline signals, index i holds signal after i register stages
+  logic               [0:NUM_OUT_REGS][WIDTH-1:0] out_pipe_result_q;
+  fpnew_pkg::status_t [0:NUM_OUT_REGS]            out_pipe_status_q;
+  TagType             [0:NUM_OUT_REGS]            out_pipe_tag_q;
+  AuxType             [0:NUM_OUT_REGS]            out_pipe_aux_q;
+  logic               [0:NUM_OUT_REGS]            out_pipe_valid_q;
+  // Ready signal is combinatorial for all stages
+  logic [0:NUM_OUT_REGS] out_pipe_ready;
+
+  // Input stage: First element of pipeline is taken from inputs
+  assign out_pipe_result_q[0] = result_d;
+  assign out_pipe_status_q[0] = status_d;
+  assign out_pipe_tag_q[0]    = mid_pipe_tag_q[NUM_MID_REGS];
+  assign out_pipe_aux_q[0]    = mid_pipe_aux_q[NUM_MID_REGS];
+  assign out_pipe_valid_q[0]  = mid_pipe_valid_q[NUM_MID_REGS];
+  // Input stage: Propagate pipeline ready signal to inside pipe
+  assign mid_pipe_ready[NUM_MID_REGS] = out_pipe_ready[0];
+  // Generate the register stages
+  for (genvar i = 0; i < NUM_OUT_REGS; i++) begin : gen_output_pipeline
+    // Internal register enable for this stage
+    logic reg_ena;
+    // Determine the ready signal of the current stage - advance the pipeline:
+    // 1. if the next stage is ready for our data
+    // 2. if the next stage only holds a bubble (not valid) -> we can pop it
+    assign out_pipe_ready[i] = out_pipe_ready[i+1] | ~out_pipe_valid_q[i+1];
+    // Valid: enabled by ready signal, synchronous clear with the flush signal
+    `FFLARNC(out_pipe_valid_q[i+1], out_pipe_valid_q[i], out_pipe_ready[i], flush_i, 1'b0, clk_i, rst_ni)
+    // Enable register if pipleine ready and a valid data item is present
+    assign reg_ena = out_pipe_ready[i] & out_pipe_valid_q[i];
+    // Generate the pipeline registers within the stages, use enable-registers
+    `FFL(out_pipe_result_q[i+1], out_pipe_result_q[i], reg_ena, '0)
+    `FFL(out_pipe_status_q[i+1], out_pipe_status_q[i], reg_ena, '0)
+    `FFL(out_pipe_tag_q[i+1],    out_pipe_tag_q[i],    reg_ena, TagType'('0))
+    `FFL(out_pipe_aux_q[i+1],    out_pipe_aux_q[i],    reg_ena, AuxType'('0))
+  end
+  // Output stage: Ready travels backwards from output side, driven by downstream circuitry
+  assign out_pipe_ready[NUM_OUT_REGS] = out_ready_i;
+  // Output stage: assign module outputs
+  assign result_o        = out_pipe_result_q[NUM_OUT_REGS];
+  assign status_o        = out_pipe_status_q[NUM_OUT_REGS];
+  assign extension_bit_o = 1'b1; // always NaN-Box result
+  assign tag_o           = out_pipe_tag_q[NUM_OUT_REGS];
+  assign aux_o           = out_pipe_aux_q[NUM_OUT_REGS];
+  assign out_valid_o     = out_pipe_valid_q[NUM_OUT_REGS];
+  assign busy_o          = (| {inp_pipe_valid_q, mid_pipe_valid_q, out_pipe_valid_q});
+endmodule
@@ -0,0 +1,150 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License. You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+//
+// SPDX-License-Identifier: SHL-0.51
+
+// Author: agent <agent@local>
+
+// Subword-parallel mantissa multiplier shared by the lanes of a merged FMA slice. The mantissae of
+// all lanes are placed side by side into one array, e.g. one FP64, two FP32 or four FP16 operands
+// in a 64-bit slice. Partial products crossing the field boundaries of the current format are
+// masked, such that each lane product is found in its own field of the array product.
+module fpnew_simd_multiplier #(
+  parameter int unsigned           Width         = 64,
+  parameter fpnew_pkg::fmt_logic_t FpFmtConfig   = '1,
+  parameter logic                  EnableVectors = 1'b1,
+  // Do not change
+  localparam int unsigned NUM_LANES      = fpnew_pkg::max_num_lanes(Width, FpFmtConfig, 1'b1),
+  localparam int unsigned PRECISION_BITS = fpnew_pkg::max_man_bits(FpFmtConfig) + 1
+) (
+  // Mantissae of the lanes, left-aligned to the most precise format
+  input  logic [NUM_LANES-1:0][1:0][PRECISION_BITS-1:0] operands_i,
+  input  fpnew_pkg::fp_format_e                         fmt_i, // format of all lanes
+  // Products of the lanes, left-aligned like the product of the most precise format
+  output logic [NUM_LANES-1:0][2*PRECISION_BITS-1:0]    products_o
+);
+
+  // ----------
+  // Constants
+  // ----------
+  localparam int unsigned NUM_FORMATS = fpnew_pkg::NUM_FP_FORMATS;
+
+  // The array must hold the mantissae of all lanes of any format
+  function automatic int unsigned array_width();
+    automatic int unsigned res = 0;
+    for (int unsigned fmt = 0; fmt < NUM_FORMATS; fmt++)
+      if (FpFmtConfig[fmt])
+        res = unsigned'(fpnew_pkg::maximum(res,
+                  fpnew_pkg::num_lanes(Width, fpnew_pkg::fp_format_e'(fmt), EnableVectors)
+                  * (fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt)) + 1)));
+    return res;
+  endfunction
+
+  localparam int unsigned ARRAY_WIDTH   = array_width();
+  localparam int unsigned RESULT_WIDTH  = 2 * ARRAY_WIDTH;
+  localparam int unsigned PRODUCT_WIDTH = 2 * PRECISION_BITS;
+
+  // Multiplier bit j only meets the multiplicand bits in the same field of the given format
+  function automatic logic [ARRAY_WIDTH-1:0][ARRAY_WIDTH-1:0] field_masks(
+    fpnew_pkg::fp_format_e fmt
+  );
+    automatic int unsigned precision = fpnew_pkg::man_bits(fmt) + 1;
+    automatic logic [ARRAY_WIDTH-1:0][ARRAY_WIDTH-1:0] res = '0;
+    for (int unsigned j = 0; j < ARRAY_WIDTH; j++)
+      for (int unsigned i = 0; i < ARRAY_WIDTH; i++)
+        res[j][i] = (i / precision == j / precision);
+    return res;
+  endfunction
+
+  // -----------------
+  // Format selection
+  // -----------------
+  logic [NUM_FORMATS-1:0][1:0][ARRAY_WIDTH-1:0]              fmt_array_operands;
+  logic [NUM_FORMATS-1:0][ARRAY_WIDTH-1:0][ARRAY_WIDTH-1:0]  fmt_row_masks;
+  logic [NUM_FORMATS-1:0][NUM_LANES-1:0][PRODUCT_WIDTH-1:0]  fmt_products;
+
+  logic [RESULT_WIDTH-1:0] product; // all lane products in their fields
+
+  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_formats
+    // Set up some constants
+    localparam int unsigned FMT_PRECISION = fpnew_pkg::man_bits(fpnew_pkg::fp_format_e'(fmt)) + 1;
+    localparam int unsigned FMT_LANES =
+        fpnew_pkg::num_lanes(Width, fpnew_pkg::fp_format_e'(fmt), EnableVectors);
+
+    if (FpFmtConfig[fmt]) begin : active_format
+      assign fmt_row_masks[fmt] = field_masks(fpnew_pkg::fp_format_e'(fmt));
+
+      for (genvar lane = 0; lane < int'(NUM_LANES); lane++) begin : gen_lanes
+        if (lane < FMT_LANES) begin : active_lane
+          // The significant bits of each lane go into the field of the lane
+          for (genvar op = 0; op < 2; op++) begin : gen_operands
+            assign fmt_array_operands[fmt][op][lane*FMT_PRECISION+:FMT_PRECISION] =
+                operands_i[lane][op][PRECISION_BITS-1-:FMT_PRECISION];
+          end
+          // The product of the lane is taken from its field and left-aligned again
+          assign fmt_products[fmt][lane] =
+              PRODUCT_WIDTH'(product[2*lane*FMT_PRECISION+:2*FMT_PRECISION])
+              << 2 * (PRECISION_BITS - FMT_PRECISION);
+        end else begin : inactive_lane
+          assign fmt_products[fmt][lane] = '0;
+        end
+      end
+
+      // Bits of the array not covered by the lanes of this format stay zero
+      if (FMT_LANES * FMT_PRECISION < ARRAY_WIDTH) begin : pad_array
+        for (genvar op = 0; op < 2; op++) begin : gen_operands
+          assign fmt_array_operands[fmt][op][ARRAY_WIDTH-1:FMT_LANES*FMT_PRECISION] = '0;
+        end
+      end
+    end else begin : inactive_format
+      assign fmt_array_operands[fmt] = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_row_masks[fmt]      = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+      assign fmt_products[fmt]       = '{default: fpnew_pkg::DONT_CARE}; // format disabled
+    end
+  end
+
+  // ----------------
+  // Multiplier array
+  // ----------------
+  logic [1:0][ARRAY_WIDTH-1:0]              array_operands;
+  logic [ARRAY_WIDTH-1:0][ARRAY_WIDTH-1:0]  row_masks;
+  logic [ARRAY_WIDTH-1:0][RESULT_WIDTH-1:0] partial_products;
+  logic [RESULT_WIDTH-1:0]                  product_sum, product_carry;
+
+  assign array_operands = fmt_array_operands[fmt_i];
+  assign row_masks      = fmt_row_masks[fmt_i];
+
+  // One partial product per multiplier bit, masked to the field of that bit
+  for (genvar j = 0; j < int'(ARRAY_WIDTH); j++) begin : gen_partial_products
+    assign partial_products[j] =
+        RESULT_WIDTH'(array_operands[0] & row_masks[j] & {ARRAY_WIDTH{array_operands[1][j]}}) << j;
+  end
+
+  // The partial products are reduced without pipeline registers
+  fpnew_compressor_tree #(
+    .Width       ( RESULT_WIDTH ),
+    .NumRows     ( ARRAY_WIDTH  ),
+    .NumPipeRegs ( 0            )
+  ) i_compressor_tree (
+    .clk_i     ( 1'b0             ), // unused without pipeline registers
+    .rst_ni    ( 1'b1             ), // unused without pipeline registers
+    .rows_i    ( partial_products ),
+    .reg_ena_i ( 1'b0             ),
+    .sum_o     ( product_sum      ),
+    .carry_o   ( product_carry    )
+  );
+
+  // The lane products do not overlap, so one adder resolves all of them
+  assign product = product_sum + product_carry;
+
+  assign products_o = fmt_products[fmt_i];
+
+endmodule
@@ -13,44 +13,164 @@
 
 // Author: Stefan Mach <smach@iis.ee.ethz.ch>
 
+`include "common_cells/registers.svh"
+
 module fpnew_top #(
   // FPU configuration
-  parameter fpnew_pkg::fpu_features_t       Features       = fpnew_pkg::RV64D_Xsflt,
-  parameter fpnew_pkg::fpu_implementation_t Implementation = fpnew_pkg::DEFAULT_NOREGS,
-  parameter type                            TagType        = logic,
+  parameter fpnew_pkg::fpu_features_t       Features        = fpnew_pkg::RV64D_Xsflt,
+  parameter fpnew_pkg::fpu_implementation_t Implementation  = fpnew_pkg::DEFAULT_NOREGS,
+  parameter type                            TagType         = logic,
+  parameter int unsigned                    NumPorts        = 1,
+  parameter int unsigned                    RobDepth        = 0, // 0: out-of-order result delivery
+  parameter int unsigned                    WakeupLead      = 0, // 0: no early wakeup
+  parameter int unsigned                    NumAccumulators = 0, // 0: no accumulator forwarding
   // Do not change
   localparam int unsigned WIDTH        = Features.Width,
-  localparam int unsigned NUM_OPERANDS = 3
+  localparam int unsigned NUM_OPERANDS = 3,
+  localparam int unsigned ACC_ID_BITS  = fpnew_pkg::acc_id_bits(NumAccumulators)
 ) (
-  input logic                               clk_i,
-  input logic                               rst_ni,
+  input logic                                             clk_i,
+  input logic                                             rst_ni,
   // Input signals
-  input logic [NUM_OPERANDS-1:0][WIDTH-1:0] operands_i,
-  input fpnew_pkg::roundmode_e              rnd_mode_i,
-  input fpnew_pkg::operation_e              op_i,
-  input logic                               op_mod_i,
-  input fpnew_pkg::fp_format_e              src_fmt_i,
-  input fpnew_pkg::fp_format_e              dst_fmt_i,
-  input fpnew_pkg::int_format_e             int_fmt_i,
-  input logic                               vectorial_op_i,
-  input TagType                             tag_i,
+  input logic [NumPorts-1:0][NUM_OPERANDS-1:0][WIDTH-1:0] operands_i,
+  input fpnew_pkg::roundmode_e [NumPorts-1:0]             rnd_mode_i,
+  input fpnew_pkg::operation_e [NumPorts-1:0]             op_i,
+  input logic [NumPorts-1:0]                              op_mod_i,
+  input fpnew_pkg::fp_format_e [NumPorts-1:0]             src_fmt_i,
+  input fpnew_pkg::fp_format_e [NumPorts-1:0]             dst_fmt_i,
+  input fpnew_pkg::int_format_e [NumPorts-1:0]            int_fmt_i,
+  input logic [NumPorts-1:0]                              vectorial_op_i,
+  input TagType [NumPorts-1:0]                            tag_i,
+  input logic [NumPorts-1:0][ACC_ID_BITS-1:0]             acc_id_i,  // 0: no accumulator
+  input logic [NumPorts-1:0]                              acc_fwd_i, // addend from accumulator
+  input fpnew_pkg::mx_scales_t [NumPorts-1:0]             mx_scales_i, // MX block scales
+  // Stochastic rounding
+  input logic [fpnew_pkg::SR_SEED_BITS-1:0]               sr_seed_i,      // LFSR seed
+  input logic                                             sr_seed_load_i, // reseed all LFSRs
   // Input Handshake
-  input  logic                              in_valid_i,
-  output logic                              in_ready_o,
-  input  logic                              flush_i,
+  input  logic [NumPorts-1:0]                             in_valid_i,
+  output logic [NumPorts-1:0]                             in_ready_o,
+  input  logic                                            flush_i,
   // Output signals
-  output logic [WIDTH-1:0]                  result_o,
-  output fpnew_pkg::status_t                status_o,
-  output TagType                            tag_o,
+  output logic [NumPorts-1:0][WIDTH-1:0]                  result_o,
+  output fpnew_pkg::status_t [NumPorts-1:0]               status_o,
+  output TagType [NumPorts-1:0]                           tag_o,
   // Output handshake
-  output logic                              out_valid_o,
-  input  logic                              out_ready_i,
+  output logic [NumPorts-1:0]                             out_valid_o,
+  input  logic [NumPorts-1:0]                             out_ready_i,
+  // Early wakeup
+  output logic [NumPorts-1:0]                             wakeup_valid_o,
+  output TagType [NumPorts-1:0]                           wakeup_tag_o,
   // Indication of valid data in flight
-  output logic                              busy_o
+  output logic                                            busy_o
 );
 
-  localparam int unsigned NUM_OPGROUPS = fpnew_pkg::NUM_OPGROUPS;
-  localparam int unsigned NUM_FORMATS  = fpnew_pkg::NUM_FP_FORMATS;
+  localparam int unsigned NUM_OPGROUPS    = fpnew_pkg::NUM_OPGROUPS;
+  localparam int unsigned NUM_FORMATS     = fpnew_pkg::NUM_FP_FORMATS;
+  localparam int unsigned PORT_IDX_WIDTH  = (NumPorts > 1) ? $clog2(NumPorts) : 1;
+  localparam int unsigned OPGRP_IDX_WIDTH = $clog2(NUM_OPGROUPS);
+  // Issue stamps are only needed for age-based arbitration
+  localparam int unsigned STAMP_WIDTH = (Implementation.ArbConfig == fpnew_pkg::OLDEST_FIRST)
+                                        ? 8
+                                        : 1;
+  localparam logic        REGISTERED_READY =
+      (Implementation.ReadyConfig == fpnew_pkg::REGISTERED);
+  // With registered ready, operations enter the operation groups through an input buffer
+  localparam int unsigned BUFFER_REGS = REGISTERED_READY ? 1 : 0;
+
+  // Latency of every operation group and format including the input buffer, without backpressure
+  function automatic fpnew_pkg::opgrp_fmt_unsigned_t get_latencies();
+    automatic fpnew_pkg::opgrp_fmt_unsigned_t res;
+    for (int unsigned opgrp = 0; opgrp < NUM_OPGROUPS; opgrp++) begin
+      for (int unsigned fmt = 0; fmt < NUM_FORMATS; fmt++) begin
+        if (Implementation.UnitTypes[opgrp][fmt] == fpnew_pkg::MERGED)
+          res[opgrp][fmt] = BUFFER_REGS + fpnew_pkg::get_num_regs_multi(
+              Implementation.PipeRegs[opgrp],
+              Implementation.UnitTypes[opgrp],
+              fpnew_pkg::get_opgroup_formats(fpnew_pkg::opgroup_e'(opgrp), Features.FpFmtMask));
+        else
+          res[opgrp][fmt] = BUFFER_REGS + Implementation.PipeRegs[opgrp][fmt];
+      end
+    end
+    return res;
+  endfunction
+
+  // Operation groups whose latency only depends on the format (all except iterative DIVSQRT, and
+  // ADDMUL if operations can wait for their accumulator or for Newton-Raphson division steps,
+  // which enter without booking a writeback slot)
+  function automatic logic [NUM_OPGROUPS-1:0] get_fixed_latency_opgroups();
+    automatic logic [NUM_OPGROUPS-1:0] res;
+    for (int unsigned opgrp = 0; opgrp < NUM_OPGROUPS; opgrp++)
+      res[opgrp] = (fpnew_pkg::opgroup_e'(opgrp) != fpnew_pkg::DIVSQRT)
+                   && !(fpnew_pkg::opgroup_e'(opgrp) == fpnew_pkg::ADDMUL
+                        && (NumAccumulators > 0
+                            || Implementation.DivSqrtConfig == fpnew_pkg::NEWTON_RAPHSON));
+    return res;
+  endfunction
+
+  // Formats whose additions have the latency of the dual-path adders
+  localparam fpnew_pkg::fmt_logic_t ADD_FORMATS = fpnew_pkg::get_add_formats(
+      Implementation.AddConfig, Implementation.UnitTypes[fpnew_pkg::ADDMUL], Features.FpFmtMask,
+      Features.FtzFmtMask);
+
+  // Longest latency of all enabled fixed-latency operations
+  function automatic int unsigned get_max_latency();
+    automatic fpnew_pkg::opgrp_fmt_unsigned_t latencies = get_latencies();
+    automatic int unsigned res = 0;
+    for (int unsigned opgrp = 0; opgrp < NUM_OPGROUPS; opgrp++)
+      for (int unsigned fmt = 0; fmt < NUM_FORMATS; fmt++)
+        if (get_fixed_latency_opgroups()[opgrp] &&
+            fpnew_pkg::get_opgroup_formats(fpnew_pkg::opgroup_e'(opgrp), Features.FpFmtMask)[fmt])
+          res = fpnew_pkg::maximum(res, latencies[opgrp][fmt]);
+    for (int unsigned fmt = 0; fmt < NUM_FORMATS; fmt++)
+      if (ADD_FORMATS[fmt])
+        res = fpnew_pkg::maximum(res, BUFFER_REGS + Implementation.AddPipeRegs[fmt]);
+    return res;
+  endfunction
+
+  localparam fpnew_pkg::opgrp_fmt_unsigned_t LATENCIES     = get_latencies();
+  localparam logic [NUM_OPGROUPS-1:0]        FIXED_LATENCY = get_fixed_latency_opgroups();
+  localparam int unsigned                    MAX_LATENCY   = get_max_latency();
+  localparam logic                           EARLY_WAKEUP  = (WakeupLead > 0) && (RobDepth == 0);
+
+  // Longest latency of every operation group among enabled formats
+  function automatic fpnew_pkg::opgrp_unsigned_t get_opgrp_latencies();
+    automatic fpnew_pkg::opgrp_fmt_unsigned_t latencies = get_latencies();
+    automatic fpnew_pkg::opgrp_unsigned_t res = '0;
+    for (int unsigned opgrp = 0; opgrp < NUM_OPGROUPS; opgrp++)
+      for (int unsigned fmt = 0; fmt < NUM_FORMATS; fmt++)
+        if (fpnew_pkg::get_opgroup_formats(fpnew_pkg::opgroup_e'(opgrp), Features.FpFmtMask)[fmt])
+          res[opgrp] = fpnew_pkg::maximum(res[opgrp], latencies[opgrp][fmt]);
+    for (int unsigned fmt = 0; fmt < NUM_FORMATS; fmt++)
+      if (ADD_FORMATS[fmt])
+        res[fpnew_pkg::ADDMUL] = fpnew_pkg::maximum(res[fpnew_pkg::ADDMUL],
+                                                    BUFFER_REGS + Implementation.AddPipeRegs[fmt]);
+    return res;
+  endfunction
+
+  localparam fpnew_pkg::opgrp_unsigned_t OPGRP_LATENCIES = get_opgrp_latencies();
+
+  // Newton-Raphson division runs in the formats with ADDMUL units, whatever the DIVSQRT unit types
+  // are. Formats without infinities have no division, the sequencer only knows IEEE special values.
+  function automatic fpnew_pkg::fmt_logic_t get_nr_formats();
+    automatic fpnew_pkg::fmt_logic_t res;
+    for (int unsigned fmt = 0; fmt < NUM_FORMATS; fmt++)
+      res[fmt] = fpnew_pkg::get_opgroup_formats(fpnew_pkg::DIVSQRT, Features.FpFmtMask)[fmt]
+                 && (Implementation.UnitTypes[fpnew_pkg::ADDMUL][fmt] != fpnew_pkg::DISABLED);
+    return res;
+  endfunction
+
+  localparam logic                  NR_DIVSQRT =
+      (Implementation.DivSqrtConfig == fpnew_pkg::NEWTON_RAPHSON);
+  localparam fpnew_pkg::fmt_logic_t NR_FORMATS = get_nr_formats();
+
+  // pragma translate_off
+  initial begin : check_parameters
+    // The iterations run on the FMA units, flushed intermediate results break the final rounding
+    if (NR_DIVSQRT && (| (NR_FORMATS & Features.FtzFmtMask)))
+      $fatal(1, "NEWTON_RAPHSON division and square root cannot be used with FtzFmtMask formats.");
+  end
+  // pragma translate_on
 
   // ----------------
   // Type Definition
@@ -61,29 +181,84 @@ module fpnew_top #(
     TagType             tag;
   } output_t;
 
+  // Tag traversing the operation groups, the issue stamp occupies the low-order bits
+  typedef struct packed {
+    logic                   nr_step; // FMA operation of a Newton-Raphson division
+    TagType                 tag;
+    logic [STAMP_WIDTH-1:0] stamp;
+  } stamped_tag_t;
+
+  // Result of an operation group, including its stamped tag
+  typedef struct packed {
+    logic [WIDTH-1:0]   result;
+    fpnew_pkg::status_t status;
+    stamped_tag_t       tag;
+  } opgrp_output_t;
+
   // Handshake signals for the blocks
   logic [NUM_OPGROUPS-1:0] opgrp_in_ready, opgrp_out_valid, opgrp_out_ready, opgrp_ext, opgrp_busy;
   output_t [NUM_OPGROUPS-1:0] opgrp_outputs;
 
-  logic [NUM_FORMATS-1:0][NUM_OPERANDS-1:0] is_boxed;
+  // Issue port requests and grants per operation group
+  logic [NUM_OPGROUPS-1:0][NumPorts-1:0] opgrp_port_req, opgrp_port_gnt;
+
+  logic [NUM_OPGROUPS-1:0][STAMP_WIDTH-1:0] opgrp_stamps;
+
+  logic [NumPorts-1:0][NUM_FORMATS-1:0][NUM_OPERANDS-1:0] is_boxed;
+
+  // Ports whose operation can be accepted by the reorder buffer and the wakeup scheduler
+  logic [NumPorts-1:0] port_rob_free, port_slot_free;
+
+  // FMA operations of Newton-Raphson divisions, issued to and returned by the ADDMUL group
+  logic [NUM_OPERANDS-1:0][WIDTH-1:0] nr_fma_operands;
+  fpnew_pkg::roundmode_e              nr_fma_rnd_mode;
+  fpnew_pkg::operation_e              nr_fma_op;
+  fpnew_pkg::fp_format_e              nr_fma_fmt;
+  logic                               nr_fma_in_valid, nr_fma_in_ready;
+  logic [WIDTH-1:0]                   nr_fma_result;
+  logic                               nr_fma_out_valid, nr_fma_out_ready;
 
   // -----------
   // Input Side
   // -----------
-  assign in_ready_o = in_valid_i & opgrp_in_ready[fpnew_pkg::get_opgroup(op_i)];
+  logic [STAMP_WIDTH-1:0] issue_stamp_q;
+
+  // Operations are stamped with the number of the cycle they were issued in, only counting cycles
+  // with issued operations. Operations issued in the same cycle share the same stamp.
+  if (Implementation.ArbConfig == fpnew_pkg::OLDEST_FIRST) begin : gen_issue_stamp
+    `FFLARNC(issue_stamp_q, issue_stamp_q + 1, (| (in_valid_i & in_ready_o)), flush_i, '0, clk_i, rst_ni)
+  end else begin : no_issue_stamp
+    assign issue_stamp_q = '0;
+  end
+
+  for (genvar port = 0; port < int'(NumPorts); port++) begin : gen_input_ports
 
-  // NaN-boxing check
-  for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_nanbox_check
-    localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
-    // NaN boxing is only generated if it's enabled and needed
-    if (Features.EnableNanBox && (FP_WIDTH < WIDTH)) begin : check
-      for (genvar op = 0; op < int'(NUM_OPERANDS); op++) begin : operands
-        assign is_boxed[fmt][op] = (!vectorial_op_i)
-                                   ? operands_i[op][WIDTH-1:FP_WIDTH] == '1
-                                   : 1'b1;
+    logic [NUM_OPGROUPS-1:0] opgrp_gnt;
+
+    // Each port requests the operation group its operation belongs to
+    for (genvar opgrp = 0; opgrp < int'(NUM_OPGROUPS); opgrp++) begin : gen_opgrp_req
+      assign opgrp_port_req[opgrp][port] = in_valid_i[port] & port_rob_free[port]
+                                           & port_slot_free[port]
+                                           & (fpnew_pkg::get_opgroup(op_i[port])
+                                              == fpnew_pkg::opgroup_e'(opgrp));
+      assign opgrp_gnt[opgrp] = opgrp_port_gnt[opgrp][port];
+    end
+
+    assign in_ready_o[port] = in_valid_i[port] & (| opgrp_gnt);
+
+    // NaN-boxing check
+    for (genvar fmt = 0; fmt < int'(NUM_FORMATS); fmt++) begin : gen_nanbox_check
+      localparam int unsigned FP_WIDTH = fpnew_pkg::fp_width(fpnew_pkg::fp_format_e'(fmt));
+      // NaN boxing is only generated if it's enabled and needed
+      if (Features.EnableNanBox && (FP_WIDTH < WIDTH)) begin : check
+        for (genvar op = 0; op < int'(NUM_OPERANDS); op++) begin : operands
+          assign is_boxed[port][fmt][op] = (!vectorial_op_i[port])
+                                           ? operands_i[port][op][WIDTH-1:FP_WIDTH] == '1
+                                           : 1'b1;
+        end
+      end else begin : no_check
+        assign is_boxed[port][fmt] = '1;
       end
-    end else begin : no_check
-      assign is_boxed[fmt] = '1;
     end
   end
 
@@ -93,82 +268,685 @@ module fpnew_top #(
   for (genvar opgrp = 0; opgrp < int'(NUM_OPGROUPS); opgrp++) begin : gen_operation_groups
     localparam int unsigned NUM_OPS = fpnew_pkg::num_operands(fpnew_pkg::opgroup_e'(opgrp));
 
+    // Operation issued to the operation group
+    typedef struct packed {
+      logic [NUM_OPS-1:0][WIDTH-1:0]       operands;
+      logic [NUM_FORMATS-1:0][NUM_OPS-1:0] is_boxed;
+      fpnew_pkg::roundmode_e               rnd_mode;
+      fpnew_pkg::operation_e               op;
+      logic                                op_mod;
+      fpnew_pkg::fp_format_e               src_fmt;
+      fpnew_pkg::fp_format_e               dst_fmt;
+      fpnew_pkg::int_format_e              int_fmt;
+      logic                                vectorial_op;
+      stamped_tag_t                        tag;
+      logic [ACC_ID_BITS-1:0]              acc_id;
+      logic                                acc_fwd;
+      fpnew_pkg::mx_scales_t               mx_scales;
+    } opgrp_input_t;
+
+    logic [PORT_IDX_WIDTH-1:0] port_sel;
     logic in_valid;
     logic [NUM_FORMATS-1:0][NUM_OPS-1:0] input_boxed;
+    stamped_tag_t in_tag;
+    opgrp_input_t issued_input, queued_input; // from the issue ports, towards the block
+    logic         queued_valid, queued_ready;
+
+    // Inputs of the block, from the selected port or from a Newton-Raphson division step
+    logic [NUM_OPS-1:0][WIDTH-1:0]       block_operands;
+    logic [NUM_FORMATS-1:0][NUM_OPS-1:0] block_boxed;
+    fpnew_pkg::roundmode_e               block_rnd_mode;
+    fpnew_pkg::operation_e               block_op;
+    logic                                block_op_mod;
+    fpnew_pkg::fp_format_e               block_src_fmt, block_dst_fmt;
+    fpnew_pkg::int_format_e              block_int_fmt;
+    logic                                block_vectorial_op;
+    stamped_tag_t                        block_tag;
+    logic [ACC_ID_BITS-1:0]              block_acc_id;
+    logic                                block_acc_fwd;
+    fpnew_pkg::mx_scales_t               block_mx_scales;
+    logic                                nr_step;
+
+    opgrp_output_t block_output, buffered_output;
+    logic          block_in_valid, block_in_ready;
+    logic          block_out_valid, block_out_ready, block_busy;
+    logic          result_valid, result_ready; // results leaving the operation group
+    logic          credit_avail;
+
+    // Fixed-priority issue port selection, the lowest requesting port wins the operation group
+    always_comb begin : select_port
+      port_sel = '0;
+      for (int p = int'(NumPorts)-1; p >= 0; p--)
+        if (opgrp_port_req[opgrp][p]) port_sel = PORT_IDX_WIDTH'(p);
+    end
 
-    assign in_valid = in_valid_i & (fpnew_pkg::get_opgroup(op_i) == fpnew_pkg::opgroup_e'(opgrp));
+    assign in_valid = (| opgrp_port_req[opgrp]);
+
+    // Only the selected port is granted
+    for (genvar port = 0; port < int'(NumPorts); port++) begin : gen_port_gnt
+      assign opgrp_port_gnt[opgrp][port] = opgrp_port_req[opgrp][port] & (port_sel == port)
+                                           & opgrp_in_ready[opgrp];
+    end
+
+    assign in_tag.nr_step = 1'b0;
+    assign in_tag.tag     = tag_i[port_sel];
+    assign in_tag.stamp   = issue_stamp_q;
 
     // slice out input boxing
     always_comb begin : slice_inputs
       for (int unsigned fmt = 0; fmt < NUM_FORMATS; fmt++)
-        input_boxed[fmt] = is_boxed[fmt][NUM_OPS-1:0];
-    end
-
-    fpnew_opgroup_block #(
-      .OpGroup       ( fpnew_pkg::opgroup_e'(opgrp)    ),
-      .Width         ( WIDTH                           ),
-      .EnableVectors ( Features.EnableVectors          ),
-      .FpFmtMask     ( Features.FpFmtMask              ),
-      .IntFmtMask    ( Features.IntFmtMask             ),
-      .FmtPipeRegs   ( Implementation.PipeRegs[opgrp]  ),
-      .FmtUnitTypes  ( Implementation.UnitTypes[opgrp] ),
-      .PipeConfig    ( Implementation.PipeConfig       ),
-      .TagType       ( TagType                         )
-    ) i_opgroup_block (
-      .clk_i,
-      .rst_ni,
-      .operands_i      ( operands_i[NUM_OPS-1:0] ),
-      .is_boxed_i      ( input_boxed             ),
-      .rnd_mode_i,
-      .op_i,
-      .op_mod_i,
-      .src_fmt_i,
-      .dst_fmt_i,
-      .int_fmt_i,
-      .vectorial_op_i,
-      .tag_i,
-      .in_valid_i      ( in_valid              ),
-      .in_ready_o      ( opgrp_in_ready[opgrp] ),
-      .flush_i,
-      .result_o        ( opgrp_outputs[opgrp].result ),
-      .status_o        ( opgrp_outputs[opgrp].status ),
-      .extension_bit_o ( opgrp_ext[opgrp]            ),
-      .tag_o           ( opgrp_outputs[opgrp].tag    ),
-      .out_valid_o     ( opgrp_out_valid[opgrp]      ),
-      .out_ready_i     ( opgrp_out_ready[opgrp]      ),
-      .busy_o          ( opgrp_busy[opgrp]           )
-    );
+        input_boxed[fmt] = is_boxed[port_sel][fmt][NUM_OPS-1:0];
+    end
+
+    // Newton-Raphson division steps enter the ADDMUL operation group ahead of the issue ports
+    if (NR_DIVSQRT && (fpnew_pkg::opgroup_e'(opgrp) == fpnew_pkg::ADDMUL)) begin : gen_nr_fma_steps
+      assign nr_step          = nr_fma_in_valid;
+      assign nr_fma_in_ready  = block_in_ready;
+      assign nr_fma_result    = block_output.result;
+      assign nr_fma_out_valid = block_out_valid & block_output.tag.nr_step;
+    end else begin : no_nr_fma_steps
+      assign nr_step = 1'b0;
+    end
+
+    // MX operations enter the operation group as their base operation with the block scales, all
+    // other operations are unscaled whatever is driven on mx_scales_i
+    assign issued_input = '{operands:     operands_i[port_sel][NUM_OPS-1:0],
+                            is_boxed:     input_boxed,
+                            rnd_mode:     rnd_mode_i[port_sel],
+                            op:           fpnew_pkg::mx_base_op(op_i[port_sel]),
+                            op_mod:       op_mod_i[port_sel],
+                            src_fmt:      src_fmt_i[port_sel],
+                            dst_fmt:      dst_fmt_i[port_sel],
+                            int_fmt:      int_fmt_i[port_sel],
+                            vectorial_op: vectorial_op_i[port_sel],
+                            tag:          in_tag,
+                            acc_id:       acc_id_i[port_sel],
+                            acc_fwd:      acc_fwd_i[port_sel],
+                            mx_scales:    fpnew_pkg::is_mx_op(op_i[port_sel])
+                                          ? mx_scales_i[port_sel] : fpnew_pkg::MX_NO_SCALE};
+
+    // -------------
+    // Input Buffer
+    // -------------
+    // With registered ready, issued operations are buffered in front of the operation group. Its
+    // ready signal, which depends on the slice arbiters and the pipeline stages, then only reaches
+    // the buffer and not in_ready_o. The two entries allow issuing an operation every cycle.
+    if (REGISTERED_READY) begin : gen_input_buffer
+      logic buffer_full, buffer_empty;
+
+      fifo_v3 #(
+        .FALL_THROUGH ( 1'b0          ),
+        .DEPTH        ( 2             ),
+        .dtype        ( opgrp_input_t )
+      ) i_input_buffer (
+        .clk_i,
+        .rst_ni,
+        .flush_i,
+        .testmode_i ( 1'b0                            ),
+        .full_o     ( buffer_full                     ),
+        .empty_o    ( buffer_empty                    ),
+        .usage_o    ( /* unused */                    ),
+        .data_i     ( issued_input                    ),
+        .push_i     ( in_valid & opgrp_in_ready[opgrp] ),
+        .data_o     ( queued_input                    ),
+        .pop_i      ( queued_valid & queued_ready     )
+      );
+
+      assign queued_valid          = ~buffer_empty;
+      assign opgrp_in_ready[opgrp] = ~buffer_full & credit_avail;
+
+    end else begin : no_input_buffer
+      assign queued_input          = issued_input;
+      assign queued_valid          = in_valid & credit_avail;
+      assign opgrp_in_ready[opgrp] = queued_ready & credit_avail;
+    end
+
+    always_comb begin : select_inputs
+      if (nr_step) begin
+        // Scalar operation in the destination format, the operands are NaN-boxed
+        block_operands     = nr_fma_operands[NUM_OPS-1:0];
+        block_boxed        = '1;
+        block_rnd_mode     = nr_fma_rnd_mode;
+        block_op           = nr_fma_op;
+        block_op_mod       = 1'b0;
+        block_src_fmt      = nr_fma_fmt;
+        block_dst_fmt      = nr_fma_fmt;
+        block_int_fmt      = fpnew_pkg::int_format_e'(0);
+        block_vectorial_op = 1'b0;
+        block_tag          = '{nr_step: 1'b1,
+                               tag:     TagType'(fpnew_pkg::DONT_CARE),
+                               stamp:   issue_stamp_q};
+        block_acc_id       = '0;
+        block_acc_fwd      = 1'b0;
+        block_mx_scales    = fpnew_pkg::MX_NO_SCALE;
+      end else begin
+        block_operands     = queued_input.operands;
+        block_boxed        = queued_input.is_boxed;
+        block_rnd_mode     = queued_input.rnd_mode;
+        block_op           = queued_input.op;
+        block_op_mod       = queued_input.op_mod;
+        block_src_fmt      = queued_input.src_fmt;
+        block_dst_fmt      = queued_input.dst_fmt;
+        block_int_fmt      = queued_input.int_fmt;
+        block_vectorial_op = queued_input.vectorial_op;
+        block_tag          = queued_input.tag;
+        block_acc_id       = queued_input.acc_id;
+        block_acc_fwd      = queued_input.acc_fwd;
+        block_mx_scales    = queued_input.mx_scales;
+      end
+    end
+
+    // Division and square root by Newton-Raphson iterations replaces the DIVSQRT units
+    if (NR_DIVSQRT && (fpnew_pkg::opgroup_e'(opgrp) == fpnew_pkg::DIVSQRT)) begin : gen_divsqrt_nr
+      logic nr_in_ready;
+
+      fpnew_divsqrt_nr #(
+        .FpFmtConfig ( NR_FORMATS    ),
+        .Width       ( WIDTH         ),
+        .TagType     ( stamped_tag_t )
+      ) i_divsqrt_nr (
+        .clk_i,
+        .rst_ni,
+        .operands_i      ( block_operands                             ),
+        .is_boxed_i      ( block_boxed                                ),
+        .rnd_mode_i      ( block_rnd_mode                             ),
+        .op_i            ( block_op                                   ),
+        .dst_fmt_i       ( block_dst_fmt                              ),
+        .tag_i           ( block_tag                                  ),
+        .in_valid_i      ( block_in_valid & NR_FORMATS[block_dst_fmt] ),
+        .in_ready_o      ( nr_in_ready                                ),
+        .flush_i,
+        .result_o        ( block_output.result                        ),
+        .status_o        ( block_output.status                        ),
+        .extension_bit_o ( opgrp_ext[opgrp]                           ),
+        .tag_o           ( block_output.tag                           ),
+        .out_valid_o     ( block_out_valid                            ),
+        .out_ready_i     ( block_out_ready                            ),
+        .busy_o          ( block_busy                                 ),
+        .fma_operands_o  ( nr_fma_operands                            ),
+        .fma_rnd_mode_o  ( nr_fma_rnd_mode                            ),
+        .fma_op_o        ( nr_fma_op                                  ),
+        .fma_fmt_o       ( nr_fma_fmt                                 ),
+        .fma_in_valid_o  ( nr_fma_in_valid                            ),
+        .fma_in_ready_i  ( nr_fma_in_ready                            ),
+        .fma_result_i    ( nr_fma_result                              ),
+        .fma_out_valid_i ( nr_fma_out_valid                           ),
+        .fma_out_ready_o ( nr_fma_out_ready                           )
+      );
+
+      // Formats without FMA units don't accept operations
+      assign block_in_ready = nr_in_ready & NR_FORMATS[block_dst_fmt];
+
+    end else begin : gen_opgroup_block
+      fpnew_opgroup_block #(
+        .OpGroup          ( fpnew_pkg::opgroup_e'(opgrp)    ),
+        .Width            ( WIDTH                           ),
+        .EnableVectors    ( Features.EnableVectors          ),
+        .FpFmtMask        ( Features.FpFmtMask              ),
+        .IntFmtMask       ( Features.IntFmtMask             ),
+        .FtzFmtMask       ( Features.FtzFmtMask             ),
+        .FmtPipeRegs      ( Implementation.PipeRegs[opgrp]  ),
+        .FmtUnitTypes     ( Implementation.UnitTypes[opgrp] ),
+        .PipeConfig       ( Implementation.PipeConfig       ),
+        .ArbConfig        ( Implementation.ArbConfig        ),
+        .DivSqrtUnits     ( Implementation.DivSqrtUnits     ),
+        .DivSqrtConfig    ( Implementation.DivSqrtConfig    ),
+        .DivSqrtPrecision ( Implementation.DivSqrtPrecision ),
+        .AddConfig        ( Implementation.AddConfig        ),
+        .AddPipeRegs      ( Implementation.AddPipeRegs      ),
+        .MulConfig        ( Implementation.MulConfig        ),
+        .NumAccumulators  ( NumAccumulators                 ),
+        .TagType          ( stamped_tag_t                   ),
+        .StampWidth       ( STAMP_WIDTH                     )
+      ) i_opgroup_block (
+        .clk_i,
+        .rst_ni,
+        .operands_i      ( block_operands      ),
+        .is_boxed_i      ( block_boxed         ),
+        .rnd_mode_i      ( block_rnd_mode      ),
+        .op_i            ( block_op            ),
+        .op_mod_i        ( block_op_mod        ),
+        .src_fmt_i       ( block_src_fmt       ),
+        .dst_fmt_i       ( block_dst_fmt       ),
+        .int_fmt_i       ( block_int_fmt       ),
+        .vectorial_op_i  ( block_vectorial_op  ),
+        .tag_i           ( block_tag           ),
+        .acc_id_i        ( block_acc_id        ),
+        .acc_fwd_i       ( block_acc_fwd       ),
+        .mx_scales_i     ( block_mx_scales     ),
+        .sr_seed_i,
+        .sr_seed_load_i,
+        .in_valid_i      ( block_in_valid      ),
+        .in_ready_o      ( block_in_ready      ),
+        .flush_i,
+        .result_o        ( block_output.result ),
+        .status_o        ( block_output.status ),
+        .extension_bit_o ( opgrp_ext[opgrp]    ),
+        .tag_o           ( block_output.tag    ),
+        .out_valid_o     ( block_out_valid     ),
+        .out_ready_i     ( block_out_ready     ),
+        .busy_o          ( block_busy          )
+      );
+    end
+
+    // Operations are only issued if there is a credit for their result. Division steps don't need
+    // one, their results return to the division.
+    assign block_in_valid = nr_step | queued_valid;
+    assign queued_ready   = block_in_ready & ~nr_step;
+
+    // Results of division steps never leave the operation group
+    assign result_valid    = block_out_valid & ~block_output.tag.nr_step;
+    assign block_out_ready = block_output.tag.nr_step ? nr_fma_out_ready : result_ready;
+
+    // --------------
+    // Result Buffer
+    // --------------
+    // Results waiting for the output are buffered so the operation group keeps accepting work
+    if (Implementation.ResultFifoDepth[opgrp] > 0 || REGISTERED_READY) begin : gen_result_fifo
+
+      // With registered ready, the buffer must hold all results in flight for full throughput
+      localparam int unsigned NUM_IN_FLIGHT = (fpnew_pkg::opgroup_e'(opgrp) == fpnew_pkg::DIVSQRT)
+                                              ? OPGRP_LATENCIES[opgrp] + Implementation.DivSqrtUnits
+                                              : OPGRP_LATENCIES[opgrp] + 1;
+      localparam int unsigned FIFO_DEPTH = REGISTERED_READY
+          ? fpnew_pkg::maximum(Implementation.ResultFifoDepth[opgrp], NUM_IN_FLIGHT)
+          : Implementation.ResultFifoDepth[opgrp];
+
+      logic fifo_full, fifo_empty;
+
+      fifo_v3 #(
+        .FALL_THROUGH ( 1'b1           ),
+        .DEPTH        ( FIFO_DEPTH     ),
+        .dtype        ( opgrp_output_t )
+      ) i_result_fifo (
+        .clk_i,
+        .rst_ni,
+        .flush_i,
+        .testmode_i ( 1'b0                           ),
+        .full_o     ( fifo_full                      ),
+        .empty_o    ( fifo_empty                     ),
+        .usage_o    ( /* unused */                   ),
+        .data_i     ( block_output                   ),
+        .push_i     ( result_valid & ~fifo_full      ),
+        .data_o     ( buffered_output                ),
+        .pop_i      ( opgrp_out_ready[opgrp]         )
+      );
+
+      assign opgrp_out_valid[opgrp] = ~fifo_empty;
+      assign opgrp_busy[opgrp]      = block_busy | ~fifo_empty;
+
+      // Registered ready: every operation in flight holds a credit for a FIFO slot from its issue
+      // on, so the FIFO never fills up and the output ready no longer reaches the operation group.
+      // Input ready only depends on the registered credit counter and the input buffer.
+      if (REGISTERED_READY) begin : gen_credits
+        localparam int unsigned CREDIT_WIDTH = $clog2(FIFO_DEPTH + 1);
+
+        logic [CREDIT_WIDTH-1:0] credits_q, credits_d;
+
+        always_comb begin : update_credits
+          credits_d = credits_q;
+          if (in_valid && opgrp_in_ready[opgrp]) credits_d -= 1;
+          if (opgrp_out_valid[opgrp] && opgrp_out_ready[opgrp]) credits_d += 1;
+          if (flush_i) credits_d = CREDIT_WIDTH'(FIFO_DEPTH);
+        end
+
+        `FF(credits_q, credits_d, CREDIT_WIDTH'(FIFO_DEPTH), clk_i, rst_ni)
+
+        assign credit_avail = (credits_q != '0);
+        assign result_ready = 1'b1;
+
+      end else begin : no_credits
+        assign credit_avail = 1'b1;
+        assign result_ready = ~fifo_full;
+      end
+
+    end else begin : no_result_fifo
+      assign buffered_output        = block_output;
+      assign result_ready           = opgrp_out_ready[opgrp];
+      assign opgrp_out_valid[opgrp] = result_valid;
+      assign opgrp_busy[opgrp]      = block_busy;
+      assign credit_avail           = 1'b1;
+    end
+
+    // Unpack the result for arbitration
+    assign opgrp_outputs[opgrp].result = buffered_output.result;
+    assign opgrp_outputs[opgrp].status = buffered_output.status;
+    assign opgrp_outputs[opgrp].tag    = buffered_output.tag.tag;
+    assign opgrp_stamps[opgrp]         = buffered_output.tag.stamp;
   end
 
+  // Tie off the Newton-Raphson division interface if unused
+  if (!NR_DIVSQRT) begin : no_nr_divsqrt
+    assign nr_fma_operands  = '{default: fpnew_pkg::DONT_CARE};
+    assign nr_fma_rnd_mode  = fpnew_pkg::RNE;
+    assign nr_fma_op        = fpnew_pkg::FMADD;
+    assign nr_fma_fmt       = fpnew_pkg::fp_format_e'(0);
+    assign nr_fma_in_valid  = 1'b0;
+    assign nr_fma_in_ready  = 1'b0;
+    assign nr_fma_result    = '{default: fpnew_pkg::DONT_CARE};
+    assign nr_fma_out_valid = 1'b0;
+    assign nr_fma_out_ready = 1'b0;
+  end
+
+  // -------------
+  // Early Wakeup
+  // -------------
+  // Results of fixed-latency operations are scheduled into writeback slots when they are issued.
+  // Each operation group delivers at most one and the FPU at most NumPorts results per slot, so
+  // scheduled results never lose arbitration and arrive exactly at their slot, as long as there is
+  // no backpressure. This allows to announce them WakeupLead cycles ahead of time.
+  if (EARLY_WAKEUP) begin : gen_early_wakeup
+
+    localparam int unsigned NUM_SLOTS = MAX_LATENCY + 1; // slot 0 is the current cycle
+    localparam int unsigned CNT_WIDTH = $clog2(NumPorts + 1);
+
+    typedef struct packed {
+      logic   valid;
+      TagType tag;
+    } wakeup_t;
+
+    logic [NUM_SLOTS-1:0][NUM_OPGROUPS-1:0] opgrp_slot_q, opgrp_slot_d; // slot taken by opgroup
+    logic [NUM_SLOTS-1:0][CNT_WIDTH-1:0]    result_cnt_q, result_cnt_d; // results per slot
+    wakeup_t [NUM_SLOTS-1:0][NumPorts-1:0]  wakeup_q, wakeup_d;         // wakeups per slot
+
+    logic [NumPorts-1:0]                    port_scheduled;
+    logic [NumPorts-1:0][OPGRP_IDX_WIDTH-1:0] port_opgrp;
+    logic [NumPorts-1:0][31:0]              port_latency, port_wakeup_slot;
+    logic [NUM_SLOTS-1:0][CNT_WIDTH-1:0]    wakeup_cnt;
+
+    // Latency of the operation on each port
+    for (genvar port = 0; port < int'(NumPorts); port++) begin : gen_port_latency
+      assign port_opgrp[port]     = fpnew_pkg::get_opgroup(op_i[port]);
+      // Operations on disabled formats are not scheduled (their results are never produced)
+      assign port_scheduled[port] = FIXED_LATENCY[port_opgrp[port]]
+                                    & Features.FpFmtMask[dst_fmt_i[port]];
+      // Non-widening additions without stochastic rounding or accumulators take the dual-path
+      // adders if present
+      assign port_latency[port]   = !port_scheduled[port]
+                                    ? '0
+                                    : (op_i[port] == fpnew_pkg::ADD && ADD_FORMATS[dst_fmt_i[port]]
+                                       && src_fmt_i[port] == dst_fmt_i[port]
+                                       && rnd_mode_i[port] != fpnew_pkg::RSR
+                                       && !(NumAccumulators > 0
+                                            && (acc_id_i[port] != '0 || acc_fwd_i[port])))
+                                      ? BUFFER_REGS + Implementation.AddPipeRegs[dst_fmt_i[port]]
+                                      : LATENCIES[port_opgrp[port]][dst_fmt_i[port]];
+      // Wakeups for operations shorter than the lead are issued immediately
+      assign port_wakeup_slot[port] = (port_latency[port] > WakeupLead)
+                                      ? port_latency[port] - WakeupLead
+                                      : '0;
+    end
+
+    // Number of wakeups already scheduled per slot
+    always_comb begin : count_wakeups
+      for (int unsigned slot = 0; slot < NUM_SLOTS; slot++) begin
+        wakeup_cnt[slot] = '0;
+        for (int unsigned i = 0; i < NumPorts; i++)
+          wakeup_cnt[slot] += wakeup_q[slot][i].valid;
+      end
+    end
+
+    // An operation is only issued if its result and wakeup slots are available. Ports are checked
+    // in order and each port conservatively claims its slots, whether it is issued or not.
+    always_comb begin : check_slots
+      automatic logic [NUM_SLOTS-1:0][CNT_WIDTH-1:0] result_cnt = result_cnt_q;
+      automatic logic [NUM_SLOTS-1:0][CNT_WIDTH-1:0] wakeup_claims = wakeup_cnt;
+      for (int unsigned port = 0; port < NumPorts; port++) begin
+        port_slot_free[port] = 1'b1;
+        if (in_valid_i[port] && port_scheduled[port]) begin
+          port_slot_free[port] = !opgrp_slot_q[port_latency[port]][port_opgrp[port]]
+                                 && (result_cnt[port_latency[port]] < NumPorts)
+                                 && (wakeup_claims[port_wakeup_slot[port]] < NumPorts);
+          if (port_slot_free[port]) begin
+            result_cnt[port_latency[port]]       += 1;
+            wakeup_claims[port_wakeup_slot[port]] += 1;
+          end
+        end
+      end
+    end
+
+    // Advance the schedule by one cycle and enter the newly issued operations
+    always_comb begin : update_schedule
+      // Default assignments, slots move one cycle closer
+      opgrp_slot_d = '0;
+      result_cnt_d = '0;
+      wakeup_d     = '0;
+      for (int unsigned slot = 1; slot < NUM_SLOTS; slot++) begin
+        opgrp_slot_d[slot-1] = opgrp_slot_q[slot];
+        result_cnt_d[slot-1] = result_cnt_q[slot];
+        wakeup_d[slot-1]     = wakeup_q[slot];
+      end
+
+      for (int unsigned port = 0; port < NumPorts; port++) begin
+        if (in_valid_i[port] && in_ready_o[port] && port_scheduled[port]) begin
+          // Results in the current cycle need no further booking
+          if (port_latency[port] > 0) begin
+            opgrp_slot_d[port_latency[port]-1][port_opgrp[port]] = 1'b1;
+            result_cnt_d[port_latency[port]-1] += 1;
+          end
+          // Immediate wakeups are not stored, put others into the first free entry of their slot
+          if (port_wakeup_slot[port] > 0) begin
+            automatic logic stored = 1'b0;
+            for (int unsigned i = 0; i < NumPorts; i++) begin
+              if (!stored && !wakeup_d[port_wakeup_slot[port]-1][i].valid) begin
+                wakeup_d[port_wakeup_slot[port]-1][i].valid = 1'b1;
+                wakeup_d[port_wakeup_slot[port]-1][i].tag   = tag_i[port];
+                stored = 1'b1;
+              end
+            end
+          end
+        end
+      end
+
+      if (flush_i) begin
+        opgrp_slot_d = '0;
+        result_cnt_d = '0;
+        wakeup_d     = '0;
+      end
+    end
+
+    `FF(opgrp_slot_q, opgrp_slot_d, '0, clk_i, rst_ni)
+    `FF(result_cnt_q, result_cnt_d, '0, clk_i, rst_ni)
+    `FF(wakeup_q, wakeup_d, '0, clk_i, rst_ni)
+
+    // Announce the wakeups of the current slot, immediate wakeups fill up the free ports
+    always_comb begin : emit_wakeups
+      automatic wakeup_t [NumPorts-1:0] wakeups = wakeup_q[0];
+      for (int unsigned port = 0; port < NumPorts; port++) begin
+        if (in_valid_i[port] && in_ready_o[port] && port_scheduled[port]
+            && port_wakeup_slot[port] == 0) begin
+          automatic logic stored = 1'b0;
+          for (int unsigned i = 0; i < NumPorts; i++) begin
+            if (!stored && !wakeups[i].valid) begin
+              wakeups[i].valid = 1'b1;
+              wakeups[i].tag   = tag_i[port];
+              stored = 1'b1;
+            end
+          end
+        end
+      end
+      for (int unsigned i = 0; i < NumPorts; i++) begin
+        wakeup_valid_o[i] = wakeups[i].valid;
+        wakeup_tag_o[i]   = wakeups[i].tag;
+      end
+    end
+
+  end else begin : no_early_wakeup
+    assign port_slot_free = '1;
+    assign wakeup_valid_o = '0;
+    assign wakeup_tag_o   = '{default: TagType'(fpnew_pkg::DONT_CARE)};
+  end
+
+  // -------------------------
+  // In-Order Result Delivery
+  // -------------------------
+  logic rob_busy;
+
+  if (RobDepth > 0) begin : gen_reorder_buffer
+
+    localparam int unsigned ROB_IDX_WIDTH = $clog2(RobDepth);
+
+    output_t [RobDepth-1:0]   rob_entries_q, rob_entries_d;
+    logic [RobDepth-1:0]      rob_alloc_q, rob_alloc_d;   // entry reserved for an issued operation
+    logic [RobDepth-1:0]      rob_done_q, rob_done_d;     // entry holds the result
+    logic [ROB_IDX_WIDTH-1:0] rob_head_q, rob_head_d;     // oldest operation, next to retire
+
+    logic [NumPorts-1:0][ROB_IDX_WIDTH-1:0]     port_rob_idx;
+    logic [NUM_OPGROUPS-1:0][ROB_IDX_WIDTH-1:0] opgrp_rob_idx;
+
+    // pragma translate_off
+    initial begin : check_rob_depth
+      if (RobDepth != 2**ROB_IDX_WIDTH || RobDepth < 2)
+        $fatal(1, "RobDepth must be a power of two and at least 2.");
+      if (ROB_IDX_WIDTH > $bits(TagType))
+        $fatal(1, "TagType must hold at least $clog2(RobDepth) bits to index the reorder buffer.");
+    end
+    // pragma translate_on
+
+    // Tags are sequence numbers, their low-order bits index the reorder buffer
+    for (genvar port = 0; port < int'(NumPorts); port++) begin : gen_port_idx
+      logic [$bits(TagType)-1:0] tag_bits;
+      assign tag_bits            = tag_i[port];
+      assign port_rob_idx[port]  = tag_bits[ROB_IDX_WIDTH-1:0];
+      assign port_rob_free[port] = ~rob_alloc_q[port_rob_idx[port]];
+    end
+
+    for (genvar opgrp = 0; opgrp < int'(NUM_OPGROUPS); opgrp++) begin : gen_opgrp_idx
+      logic [$bits(TagType)-1:0] tag_bits;
+      assign tag_bits             = opgrp_outputs[opgrp].tag;
+      assign opgrp_rob_idx[opgrp] = tag_bits[ROB_IDX_WIDTH-1:0];
+    end
+
+    // Every issued operation owns an entry, so valid results are always accepted. Ready is only
+    // given to valid results such that empty result FIFOs are never popped.
+    assign opgrp_out_ready = opgrp_out_valid;
+
+    always_comb begin : rob_update
+      // Default assignments
+      rob_entries_d = rob_entries_q;
+      rob_alloc_d   = rob_alloc_q;
+      rob_done_d    = rob_done_q;
+      rob_head_d    = rob_head_q;
+
+      // Retire the oldest operation through the first port
+      if (out_valid_o[0] && out_ready_i[0]) begin
+        rob_alloc_d[rob_head_q] = 1'b0;
+        rob_done_d[rob_head_q]  = 1'b0;
+        rob_head_d              = rob_head_q + 1;
+      end
+
+      // Reserve entries for issued operations
+      for (int unsigned port = 0; port < NumPorts; port++)
+        if (in_valid_i[port] && in_ready_o[port]) rob_alloc_d[port_rob_idx[port]] = 1'b1;
+
+      // Write back results in any order
+      for (int unsigned opgrp = 0; opgrp < NUM_OPGROUPS; opgrp++) begin
+        if (opgrp_out_valid[opgrp]) begin
+          rob_entries_d[opgrp_rob_idx[opgrp]] = opgrp_outputs[opgrp];
+          rob_done_d[opgrp_rob_idx[opgrp]]    = 1'b1;
+        end
+      end
+
+      // Sequence numbers restart from zero after a flush
+      if (flush_i) begin
+        rob_alloc_d = '0;
+        rob_done_d  = '0;
+        rob_head_d  = '0;
+      end
+    end
+
+    `FF(rob_entries_q, rob_entries_d, '0, clk_i, rst_ni)
+    `FF(rob_alloc_q, rob_alloc_d, '0, clk_i, rst_ni)
+    `FF(rob_done_q, rob_done_d, '0, clk_i, rst_ni)
+    `FF(rob_head_q, rob_head_d, '0, clk_i, rst_ni)
+
+    // Results leave in issue order through the first port only
+    assign out_valid_o[0] = rob_done_q[rob_head_q];
+    assign result_o[0]    = rob_entries_q[rob_head_q].result;
+    assign status_o[0]    = rob_entries_q[rob_head_q].status;
+    assign tag_o[0]       = rob_entries_q[rob_head_q].tag;
+
+    for (genvar port = 1; port < int'(NumPorts); port++) begin : gen_unused_ports
+      assign out_valid_o[port] = 1'b0;
+      assign result_o[port]    = '{default: fpnew_pkg::DONT_CARE};
+      assign status_o[port]    = '{default: fpnew_pkg::DONT_CARE};
+      assign tag_o[port]       = TagType'(fpnew_pkg::DONT_CARE);
+    end
+
+    assign rob_busy = (| rob_alloc_q);
+
   // ------------------
   // Arbitrate Outputs
   // ------------------
-  output_t arbiter_output;
-
-  // Round-Robin arbiter to decide which result to use
-  rr_arb_tree #(
-    .NumIn     ( NUM_OPGROUPS ),
-    .DataType  ( output_t     ),
-    .AxiVldRdy ( 1'b1         )
-  ) i_arbiter (
-    .clk_i,
-    .rst_ni,
-    .flush_i,
-    .rr_i   ( '0             ),
-    .req_i  ( opgrp_out_valid ),
-    .gnt_o  ( opgrp_out_ready ),
-    .data_i ( opgrp_outputs   ),
-    .gnt_i  ( out_ready_i     ),
-    .req_o  ( out_valid_o     ),
-    .data_o ( arbiter_output  ),
-    .idx_o  ( /* unused */    )
-  );
-
-  // Unpack output
-  assign result_o        = arbiter_output.result;
-  assign status_o        = arbiter_output.status;
-  assign tag_o           = arbiter_output.tag;
-
-  assign busy_o = (| opgrp_busy);
+  end else begin : gen_output_arbiters
+
+    logic [NumPorts-1:0][NUM_OPGROUPS-1:0] port_out_gnt, port_out_req;
+    logic [NumPorts:0][NUM_OPGROUPS-1:0]   opgrp_taken; // results already picked by lower ports
+
+    assign port_rob_free  = '1;
+    assign opgrp_taken[0] = '0;
+
+    // One arbiter per output port, each port only sees results not selected by any lower port
+    for (genvar port = 0; port < int'(NumPorts); port++) begin : gen_output_ports
+
+      output_t                    arbiter_output;
+      logic [OPGRP_IDX_WIDTH-1:0] arbiter_idx;
+      logic [NUM_OPGROUPS-1:0]    port_sel_mask, remaining;
+
+      assign remaining = opgrp_out_valid & ~opgrp_taken[port];
+
+      // Scheduled results must leave in their slot, other results only get the remaining ports
+      if (EARLY_WAKEUP) begin : gen_scheduled_first
+        assign port_out_req[port] = (| (remaining & FIXED_LATENCY))
+                                    ? remaining & FIXED_LATENCY
+                                    : remaining;
+      end else begin : gen_all_equal
+        assign port_out_req[port] = remaining;
+      end
+
+      // Arbiter to decide which result to use
+      fpnew_arbiter #(
+        .NumIn      ( NUM_OPGROUPS              ),
+        .DataType   ( output_t                  ),
+        .ArbConfig  ( Implementation.ArbConfig  ),
+        .StampWidth ( STAMP_WIDTH               )
+      ) i_arbiter (
+        .clk_i,
+        .rst_ni,
+        .flush_i,
+        .req_i   ( port_out_req[port]                  ),
+        .gnt_o   ( port_out_gnt[port]                  ),
+        .data_i  ( opgrp_outputs                       ),
+        .stamp_i ( opgrp_stamps                        ),
+        .gnt_i   ( out_ready_i[port]                   ),
+        .req_o   ( out_valid_o[port]                   ),
+        .data_o  ( arbiter_output                      ),
+        .idx_o   ( arbiter_idx                         )
+      );
+
+      always_comb begin : mark_taken
+        port_sel_mask              = '0;
+        port_sel_mask[arbiter_idx] = out_valid_o[port];
+      end
+
+      assign opgrp_taken[port+1] = opgrp_taken[port] | port_sel_mask;
+
+      // Unpack output
+      assign result_o[port] = arbiter_output.result;
+      assign status_o[port] = arbiter_output.status;
+      assign tag_o[port]    = arbiter_output.tag;
+    end
+
+    // An operation group is released as soon as any port takes its result
+    always_comb begin : collect_grants
+      opgrp_out_ready = '0;
+      for (int unsigned port = 0; port < NumPorts; port++)
+        opgrp_out_ready |= port_out_gnt[port];
+    end
+
+    assign rob_busy = 1'b0;
+  end
+
+  assign busy_o = (| opgrp_busy) | rob_busy;
 
 endmodule